@@ -0,0 +1,101 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Listeners are only available with the external interfaces enabled.
+#define CATCH_CONFIG_EXTERNAL_INTERFACES
+#include "../../test/src/Catch2.h"
+
+#include "BenchmarkUtils.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+#include <QtGlobal>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct BenchmarkResult
+{
+  std::string testCase;
+  std::string message;
+  double milliseconds;
+};
+
+std::vector<BenchmarkResult>& benchmarkResults()
+{
+  static auto results = std::vector<BenchmarkResult>{};
+  return results;
+}
+
+void writeBenchmarkResults(const QString& path)
+{
+  auto results = QJsonArray{};
+  for (const auto& result : benchmarkResults())
+  {
+    results.append(QJsonObject{
+      {"testCase", QString::fromStdString(result.testCase)},
+      {"name", QString::fromStdString(result.message)},
+      {"milliseconds", result.milliseconds},
+    });
+  }
+
+  auto file = QFile{path};
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    fprintf(
+      stderr,
+      "Could not write benchmark results to '%s'\n",
+      path.toStdString().c_str());
+    return;
+  }
+
+  file.write(QJsonDocument{QJsonObject{{"results", results}}}.toJson());
+}
+
+class BenchmarkResultWriter : public Catch::TestEventListenerBase
+{
+public:
+  using TestEventListenerBase::TestEventListenerBase;
+
+  void testRunEnded(const Catch::TestRunStats& testRunStats) override
+  {
+    if (const auto path = qEnvironmentVariable("TB_BENCHMARK_JSON"); !path.isEmpty())
+    {
+      writeBenchmarkResults(path);
+    }
+    TestEventListenerBase::testRunEnded(testRunStats);
+  }
+};
+
+} // namespace
+
+CATCH_REGISTER_LISTENER(BenchmarkResultWriter)
+
+void recordBenchmarkResult(const std::string& message, const double milliseconds)
+{
+  benchmarkResults().push_back(BenchmarkResult{
+    Catch::getResultCapture().getCurrentTestName(), message, milliseconds});
+}
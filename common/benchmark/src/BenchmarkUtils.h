@@ -22,6 +22,13 @@
 #include <chrono>
 #include <string>
 
+/**
+ * Records the result of a timed benchmark. If the TB_BENCHMARK_JSON environment variable
+ * is set, all recorded results are written to the file it names as JSON when the
+ * benchmark run ends.
+ */
+void recordBenchmarkResult(const std::string& message, double milliseconds);
+
 #ifdef __GNUC__
 #define TB_NOINLINE __attribute__((noinline))
 #else
@@ -35,9 +42,8 @@ TB_NOINLINE static void timeLambda(L&& lambda, const std::string& message)
   const auto start = std::chrono::high_resolution_clock::now();
   lambda();
   const auto end = std::chrono::high_resolution_clock::now();
+  const auto milliseconds = std::chrono::duration<double>(end - start).count() * 1000.0;
 
-  printf(
-    "Time elapsed for '%s': %fms\n",
-    message.c_str(),
-    std::chrono::duration<double>(end - start).count() * 1000.0);
+  printf("Time elapsed for '%s': %fms\n", message.c_str(), milliseconds);
+  recordBenchmarkResult(message, milliseconds);
 }
@@ -0,0 +1,83 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../test/src/Catch2.h"
+#include "BenchmarkUtils.h"
+#include "mdl/Polyhedron.h"
+#include "mdl/Polyhedron3.h"
+
+#include <fmt/format.h>
+
+#include <vector>
+
+namespace tb::mdl
+{
+namespace
+{
+
+/**
+ * Returns the vertices of a cubic grid of axis aligned cubes, as they would be passed to
+ * the convex hull when merging that many brushes.
+ */
+std::vector<vm::vec3d> makeCubeGridVertices(const size_t cubesPerAxis)
+{
+  constexpr auto CubeSize = 16.0;
+  constexpr auto Spacing = 32.0;
+
+  auto result = std::vector<vm::vec3d>{};
+  result.reserve(cubesPerAxis * cubesPerAxis * cubesPerAxis * 8);
+  for (size_t x = 0; x < cubesPerAxis; ++x)
+  {
+    for (size_t y = 0; y < cubesPerAxis; ++y)
+    {
+      for (size_t z = 0; z < cubesPerAxis; ++z)
+      {
+        const auto origin = vm::vec3d{double(x), double(y), double(z)} * Spacing;
+        for (size_t i = 0; i < 8; ++i)
+        {
+          result.push_back(
+            origin
+            + vm::vec3d{
+              i & 1 ? CubeSize : 0.0, i & 2 ? CubeSize : 0.0, i & 4 ? CubeSize : 0.0});
+        }
+      }
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("PolyhedronBenchmark.convexHullOfBrushVertices")
+{
+  for (const auto cubesPerAxis : {4u, 8u, 16u, 24u})
+  {
+    const auto vertices = makeCubeGridVertices(cubesPerAxis);
+
+    auto polyhedron = Polyhedron3{};
+    timeLambda(
+      [&]() { polyhedron = Polyhedron3{vertices}; },
+      fmt::format("convex hull of {} brush vertices", vertices.size()));
+
+    CHECK(polyhedron.closed());
+    CHECK(polyhedron.vertexCount() == 8u);
+  }
+}
+
+} // namespace tb::mdl
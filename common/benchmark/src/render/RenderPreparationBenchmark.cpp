@@ -0,0 +1,394 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../test/src/Catch2.h"
+#include "BenchmarkUtils.h"
+#include "Logger.h"
+#include "mdl/BezierPatch.h"
+#include "mdl/BrushBuilder.h"
+#include "mdl/BrushFace.h"
+#include "mdl/BrushNode.h"
+#include "mdl/EditorContext.h"
+#include "mdl/Entity.h"
+#include "mdl/EntityModelDataResource.h"
+#include "mdl/EntityModelManager.h"
+#include "mdl/EntityNode.h"
+#include "mdl/MapFormat.h"
+#include "mdl/Material.h"
+#include "mdl/PatchNode.h"
+#include "mdl/Texture.h"
+#include "render/BrushRenderer.h"
+#include "render/EntityRenderer.h"
+#include "render/FontManager.h"
+#include "render/ObjectRenderer.h"
+#include "render/OrthographicCamera.h"
+#include "render/PatchRenderer.h"
+#include "render/PerspectiveCamera.h"
+#include "render/RenderBatch.h"
+#include "render/RenderContext.h"
+#include "render/ShaderManager.h"
+#include "render/VboManager.h"
+
+#include "kdl/result.h"
+#include "kdl/vector_utils.h"
+
+#include "vm/bbox.h"
+#include "vm/vec.h"
+
+#include <fmt/format.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tb::render
+{
+namespace
+{
+
+/**
+ * These benchmarks measure the CPU side of preparing a map for rendering. They don't
+ * require an OpenGL context because the render batches are never rendered.
+ */
+
+struct MapSize
+{
+  std::string name;
+  size_t brushCount;
+  size_t entityCount;
+  size_t patchCount;
+};
+
+const auto MapSizes = std::vector<MapSize>{
+  {"small", 1'000, 250, 100},
+  {"medium", 10'000, 2'500, 1'000},
+  {"large", 50'000, 10'000, 5'000},
+};
+
+constexpr size_t NumMaterials = 256;
+constexpr size_t GridSize = 64;
+constexpr double GridSpacing = 128.0;
+
+const auto WorldBounds = vm::bbox3d{16384.0};
+
+struct BenchmarkMap
+{
+  std::vector<mdl::Material> materials;
+  std::vector<std::unique_ptr<mdl::BrushNode>> brushNodes;
+  std::vector<std::unique_ptr<mdl::EntityNode>> entityNodes;
+  std::vector<std::unique_ptr<mdl::PatchNode>> patchNodes;
+};
+
+/**
+ * Distributes objects on a regular grid centered at the origin.
+ */
+vm::vec3d gridPosition(const size_t i)
+{
+  const auto x = double(i % GridSize);
+  const auto y = double((i / GridSize) % GridSize);
+  const auto z = double(i / (GridSize * GridSize));
+  const auto offset = double(GridSize) / 2.0 * GridSpacing;
+  return vm::vec3d{x, y, z} * GridSpacing - vm::vec3d{offset, offset, 0};
+}
+
+mdl::BezierPatch makePatch(const vm::vec3d& position)
+{
+  auto controlPoints = std::vector<mdl::BezierPatch::Point>{};
+  for (size_t row = 0; row < 5; ++row)
+  {
+    for (size_t col = 0; col < 5; ++col)
+    {
+      const auto height = (row + col) % 2 == 0 ? 0.0 : 16.0;
+      controlPoints.emplace_back(
+        position.x() + double(col) * 16.0,
+        position.y() + double(row) * 16.0,
+        position.z() + height,
+        double(col) / 4.0,
+        double(row) / 4.0);
+    }
+  }
+  return mdl::BezierPatch{5, 5, std::move(controlPoints), "material"};
+}
+
+BenchmarkMap makeMap(const MapSize& mapSize)
+{
+  auto map = BenchmarkMap{};
+
+  for (size_t i = 0; i < NumMaterials; ++i)
+  {
+    auto materialName = "material " + std::to_string(i);
+    auto textureResource = createTextureResource(mdl::Texture{64, 64});
+    map.materials.emplace_back(std::move(materialName), std::move(textureResource));
+  }
+
+  auto builder = mdl::BrushBuilder{mdl::MapFormat::Standard, WorldBounds};
+
+  size_t currentMaterialIndex = 0;
+  for (size_t i = 0; i < mapSize.brushCount; ++i)
+  {
+    const auto position = gridPosition(i);
+    auto brush =
+      builder.createCuboid(vm::bbox3d{position, position + vm::vec3d{64, 64, 64}}, "")
+      | kdl::value();
+    for (auto& face : brush.faces())
+    {
+      face.setMaterial(&map.materials.at((currentMaterialIndex++) % NumMaterials));
+    }
+    map.brushNodes.push_back(std::make_unique<mdl::BrushNode>(std::move(brush)));
+  }
+
+  for (size_t i = 0; i < mapSize.entityCount; ++i)
+  {
+    const auto position = gridPosition(i) + vm::vec3d{96, 96, 96};
+    map.entityNodes.push_back(std::make_unique<mdl::EntityNode>(mdl::Entity{{
+      {"classname", "light"},
+      {"origin", fmt::format("{} {} {}", position.x(), position.y(), position.z())},
+    }}));
+  }
+
+  for (size_t i = 0; i < mapSize.patchCount; ++i)
+  {
+    const auto position = gridPosition(i) + vm::vec3d{0, 0, 80};
+    map.patchNodes.push_back(std::make_unique<mdl::PatchNode>(makePatch(position)));
+  }
+
+  return map;
+}
+
+/**
+ * Owns everything needed to create a render context without an OpenGL context.
+ */
+class HeadlessRenderContext
+{
+private:
+  PerspectiveCamera m_perspectiveCamera{
+    90.0f,
+    1.0f,
+    32768.0f,
+    Camera::Viewport{0, 0, 1920, 1080},
+    vm::vec3f{-4096, -4096, 1024},
+    vm::normalize(vm::vec3f{1, 1, -0.25f}),
+    vm::vec3f{0, 0, 1}};
+  OrthographicCamera m_orthographicCamera{
+    1.0f,
+    32768.0f,
+    Camera::Viewport{0, 0, 1920, 1080},
+    vm::vec3f{0, 0, 8192},
+    vm::vec3f{0, 0, -1},
+    vm::vec3f{0, 1, 0}};
+  FontManager m_fontManager;
+  ShaderManager m_shaderManager;
+  VboManager m_vboManager{m_shaderManager};
+
+public:
+  PerspectiveCamera& perspectiveCamera() { return m_perspectiveCamera; }
+
+  VboManager& vboManager() { return m_vboManager; }
+
+  std::unique_ptr<RenderContext> renderContext3D()
+  {
+    return makeRenderContext(RenderMode::Render3D, m_perspectiveCamera);
+  }
+
+  std::unique_ptr<RenderContext> renderContext2D()
+  {
+    return makeRenderContext(RenderMode::Render2D, m_orthographicCamera);
+  }
+
+private:
+  std::unique_ptr<RenderContext> makeRenderContext(
+    const RenderMode renderMode, const Camera& camera)
+  {
+    auto renderContext =
+      std::make_unique<RenderContext>(renderMode, camera, m_fontManager, m_shaderManager);
+
+    // rendering text requires loading fonts, which needs an OpenGL context
+    renderContext->setShowEntityClassnames(false);
+    return renderContext;
+  }
+};
+
+auto makeEntityModelManager(Logger& logger)
+{
+  return mdl::EntityModelManager{
+    [](auto resourceLoader) {
+      return std::make_shared<mdl::EntityModelDataResource>(std::move(resourceLoader));
+    },
+    logger};
+}
+
+} // namespace
+
+TEST_CASE("RenderPreparationBenchmark.objectRenderer")
+{
+  auto logger = NullLogger{};
+  auto entityModelManager = makeEntityModelManager(logger);
+  const auto editorContext = mdl::EditorContext{};
+  auto context = HeadlessRenderContext{};
+
+  for (const auto& mapSize : MapSizes)
+  {
+    const auto map = makeMap(mapSize);
+
+    auto renderer = ObjectRenderer{
+      logger, entityModelManager, editorContext, BrushRenderer::NoFilter{}};
+
+    timeLambda(
+      [&]() {
+        for (const auto& brushNode : map.brushNodes)
+        {
+          renderer.addNode(brushNode.get());
+        }
+        for (const auto& entityNode : map.entityNodes)
+        {
+          renderer.addNode(entityNode.get());
+        }
+        for (const auto& patchNode : map.patchNodes)
+        {
+          renderer.addNode(patchNode.get());
+        }
+      },
+      fmt::format("{} map: add nodes to ObjectRenderer", mapSize.name));
+
+    const auto render = [&](RenderContext& renderContext) {
+      auto renderBatch = RenderBatch{context.vboManager()};
+      renderer.renderOpaque(renderContext, renderBatch);
+      renderer.renderTransparent(renderContext, renderBatch);
+    };
+
+    auto renderContext3D = context.renderContext3D();
+    auto renderContext2D = context.renderContext2D();
+
+    timeLambda(
+      [&]() { render(*renderContext3D); },
+      fmt::format("{} map: validate ObjectRenderer in 3D view", mapSize.name));
+    timeLambda(
+      [&]() { render(*renderContext3D); },
+      fmt::format("{} map: render valid ObjectRenderer in 3D view", mapSize.name));
+    timeLambda(
+      [&]() { render(*renderContext2D); },
+      fmt::format("{} map: render ObjectRenderer in 2D view", mapSize.name));
+
+    renderer.invalidate();
+    timeLambda(
+      [&]() { render(*renderContext3D); },
+      fmt::format("{} map: revalidate ObjectRenderer in 3D view", mapSize.name));
+
+    renderer.clear();
+  }
+}
+
+TEST_CASE("RenderPreparationBenchmark.entityRenderer")
+{
+  auto logger = NullLogger{};
+  auto entityModelManager = makeEntityModelManager(logger);
+  const auto editorContext = mdl::EditorContext{};
+  auto context = HeadlessRenderContext{};
+
+  for (const auto& mapSize : MapSizes)
+  {
+    const auto map = makeMap(MapSize{mapSize.name, 0, mapSize.entityCount, 0});
+
+    auto renderer = EntityRenderer{logger, entityModelManager, editorContext};
+    for (const auto& entityNode : map.entityNodes)
+    {
+      renderer.addEntity(entityNode.get());
+    }
+
+    auto renderContext = context.renderContext3D();
+    const auto render = [&]() {
+      auto renderBatch = RenderBatch{context.vboManager()};
+      renderer.render(*renderContext, renderBatch);
+    };
+
+    // the first render call validates the entity bounds and builds their edges
+    timeLambda(
+      render,
+      fmt::format(
+        "{} map: validate bounds of {} entities", mapSize.name, mapSize.entityCount));
+
+    renderer.invalidate();
+    timeLambda(
+      render,
+      fmt::format(
+        "{} map: revalidate bounds of {} entities", mapSize.name, mapSize.entityCount));
+  }
+}
+
+TEST_CASE("RenderPreparationBenchmark.patchRenderer")
+{
+  const auto editorContext = mdl::EditorContext{};
+  auto context = HeadlessRenderContext{};
+
+  for (const auto& mapSize : MapSizes)
+  {
+    const auto map = makeMap(MapSize{mapSize.name, 0, 0, mapSize.patchCount});
+
+    auto renderer = PatchRenderer{editorContext};
+    for (const auto& patchNode : map.patchNodes)
+    {
+      renderer.addPatch(patchNode.get());
+    }
+
+    auto renderContext3D = context.renderContext3D();
+    auto renderContext2D = context.renderContext2D();
+    const auto render = [&](RenderContext& renderContext) {
+      auto renderBatch = RenderBatch{context.vboManager()};
+      renderer.render(renderContext, renderBatch);
+    };
+
+    // patch nodes tessellate their patches when they are created, so rendering them
+    // at full detail only builds the mesh from their grids
+    auto grids = std::vector<mdl::PatchGrid>{};
+    timeLambda(
+      [&]() {
+        grids = kdl::vec_transform(map.patchNodes, [](const auto& patchNode) {
+          return mdl::makePatchGrid(
+            patchNode->patch(), mdl::PatchNode::DefaultSubdivisionsPerSurface);
+        });
+      },
+      fmt::format(
+        "{} map: tessellate {} patches at full detail",
+        mapSize.name,
+        mapSize.patchCount));
+    timeLambda(
+      [&]() { render(*renderContext2D); },
+      fmt::format(
+        "{} map: build full detail mesh of {} patches",
+        mapSize.name,
+        mapSize.patchCount));
+    timeLambda(
+      [&]() { render(*renderContext3D); },
+      fmt::format(
+        "{} map: build level of detail meshes of {} patches",
+        mapSize.name,
+        mapSize.patchCount));
+
+    context.perspectiveCamera().moveTo(vm::vec3f{0, 0, 256});
+    timeLambda(
+      [&]() { render(*renderContext3D); },
+      fmt::format(
+        "{} map: update level of detail of {} patches after camera move",
+        mapSize.name,
+        mapSize.patchCount));
+    context.perspectiveCamera().moveTo(vm::vec3f{-4096, -4096, 1024});
+  }
+}
+
+} // namespace tb::render
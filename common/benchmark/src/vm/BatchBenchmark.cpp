@@ -0,0 +1,175 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../test/src/Catch2.h"
+#include "BenchmarkUtils.h"
+
+#include "vm/batch.h"
+#include "vm/bbox.h"
+#include "vm/intersection.h"
+#include "vm/mat.h"
+#include "vm/mat_ext.h"
+#include "vm/plane.h"
+#include "vm/ray.h"
+#include "vm/vec.h"
+
+#include <fmt/format.h>
+
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace tb
+{
+namespace
+{
+
+constexpr auto PointCount = size_t(1'000'000);
+constexpr auto Repetitions = 10;
+
+std::vector<vm::vec3d> makePoints(const size_t count)
+{
+  auto result = std::vector<vm::vec3d>{};
+  result.reserve(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    const auto t = double(i);
+    result.push_back(vm::vec3d{
+      4096.0 * std::sin(t), 4096.0 * std::cos(1.3 * t), 4096.0 * std::sin(0.7 * t)});
+  }
+  return result;
+}
+
+template <typename L>
+void timeRepeatedly(const L& lambda, const std::string& message)
+{
+  timeLambda(
+    [&]() {
+      for (int i = 0; i < Repetitions; ++i)
+      {
+        lambda();
+      }
+    },
+    fmt::format("{} ({} points, {} times)", message, PointCount, Repetitions));
+}
+
+} // namespace
+
+TEST_CASE("BatchBenchmark.pointDistances")
+{
+  const auto points = makePoints(PointCount);
+  const auto batch = vm::point_batchd{points};
+  const auto plane = vm::plane3d{64.0, vm::normalize(vm::vec3d{1, 2, 3})};
+
+  auto scalarDistances = std::vector<double>(PointCount);
+  timeRepeatedly(
+    [&]() {
+      for (size_t i = 0; i < PointCount; ++i)
+      {
+        scalarDistances[i] = plane.point_distance(points[i]);
+      }
+    },
+    "scalar point distances");
+
+  auto batchDistances = std::vector<double>{};
+  timeRepeatedly(
+    [&]() { vm::point_distances(plane, batch, batchDistances); },
+    "batch point distances");
+
+  CHECK(batchDistances.size() == scalarDistances.size());
+}
+
+TEST_CASE("BatchBenchmark.transform")
+{
+  const auto points = makePoints(PointCount);
+  const auto batch = vm::point_batchd{points};
+  const auto m = vm::translation_matrix(vm::vec3d{16, 32, 64})
+                 * vm::rotation_matrix(vm::vec3d{0, 0, 1}, 0.5);
+
+  auto scalarPoints = std::vector<vm::vec3d>(PointCount);
+  timeRepeatedly(
+    [&]() {
+      for (size_t i = 0; i < PointCount; ++i)
+      {
+        scalarPoints[i] = m * points[i];
+      }
+    },
+    "scalar transform");
+
+  auto batchPoints = vm::point_batchd{};
+  timeRepeatedly([&]() { vm::transform(m, batch, batchPoints); }, "batch transform");
+
+  CHECK(batchPoints.size() == scalarPoints.size());
+}
+
+TEST_CASE("BatchBenchmark.intersectRayTriangles")
+{
+  const auto points = makePoints(PointCount);
+  auto p1 = vm::point_batchd{};
+  auto p2 = vm::point_batchd{};
+  auto p3 = vm::point_batchd{};
+  for (size_t i = 0; i < PointCount; ++i)
+  {
+    p1.push_back(points[i]);
+    p2.push_back(points[i] + vm::vec3d{64, 0, 0});
+    p3.push_back(points[i] + vm::vec3d{0, 64, 0});
+  }
+
+  const auto ray = vm::ray3d{vm::vec3d{0, 0, 8192}, vm::vec3d{0, 0, -1}};
+
+  auto scalarHit = std::optional<double>{};
+  timeRepeatedly(
+    [&]() {
+      scalarHit = std::nullopt;
+      for (size_t i = 0; i < PointCount; ++i)
+      {
+        if (const auto dist = vm::intersect_ray_triangle(ray, p1[i], p2[i], p3[i]);
+            dist && (!scalarHit || *dist < *scalarHit))
+        {
+          scalarHit = dist;
+        }
+      }
+    },
+    "scalar ray triangle intersection");
+
+  auto batchHit = std::optional<std::tuple<double, size_t>>{};
+  timeRepeatedly(
+    [&]() { batchHit = vm::intersect_ray_triangles(ray, p1, p2, p3); },
+    "batch ray triangle intersection");
+
+  CHECK(batchHit.has_value() == scalarHit.has_value());
+}
+
+TEST_CASE("BatchBenchmark.bounds")
+{
+  const auto points = makePoints(PointCount);
+  const auto batch = vm::point_batchd{points};
+
+  auto scalarBounds = vm::bbox3d{};
+  timeRepeatedly(
+    [&]() { scalarBounds = vm::bbox3d::merge_all(points.begin(), points.end()); },
+    "scalar bounds");
+
+  auto batchBounds = vm::bbox3d{};
+  timeRepeatedly([&]() { batchBounds = vm::bounds(batch); }, "batch bounds");
+
+  CHECK(batchBounds == scalarBounds);
+}
+
+} // namespace tb
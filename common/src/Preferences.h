@@ -130,6 +130,12 @@ extern Preference<bool> EnableMSAA;
 extern Preference<bool> AlignmentLock;
 extern Preference<bool> UVLock;
 
+/**
+ * The maximum approximate memory usage of the undo history in megabytes. The oldest undo
+ * steps are discarded when it is exceeded. A value of 0 disables the limit.
+ */
+extern Preference<int> UndoMemoryBudget;
+
 Preference<std::filesystem::path>& RendererFontPath();
 extern Preference<int> RendererFontSize;
 
@@ -32,6 +32,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <ranges>
 #include <sstream>
 
@@ -889,6 +890,22 @@ Value evaluate(
 }
 
 
+/**
+ * Only literal operands are constant. Any other expression may depend on variables, and
+ * evaluating it in an empty context would yield a value that does not hold once the
+ * variables are defined, e.g. `spawnflags == 1` would always yield `false`.
+ */
+bool isLiteral(const ExpressionNode& expression)
+{
+  return expression.accept(kdl::overload(
+    [](const LiteralExpression&) { return true; }, [](const auto&) { return false; }));
+}
+
+bool isLiteralOrNone(const std::optional<ExpressionNode>& expression)
+{
+  return !expression || isLiteral(*expression);
+}
+
 Expression optimize(const LiteralExpression& expression)
 {
   return LiteralExpression{expression.value};
@@ -901,28 +918,24 @@ Expression optimize(const VariableExpression& expression)
 
 Expression optimize(const ArrayExpression& expression)
 {
-  auto optimizedExpressions =
+  auto optimizedExpression = ArrayExpression{
     expression.elements
-    | std::views::transform([](const auto& x) { return x.optimize(); });
+    | std::views::transform([](const auto& x) { return x.optimize(); })
+    | kdl::to_vector};
 
-  auto values = ArrayType{};
-  values.reserve(expression.elements.size());
-
-  const auto evaluationContext = EvaluationContext{};
-  for (const auto& optimizedExpression : optimizedExpressions)
+  if (std::ranges::all_of(optimizedExpression.elements, isLiteral))
   {
-    if (auto value = optimizedExpression.evaluate(evaluationContext);
+    // evaluate the array expression itself so that range elements are expanded
+    const auto evaluationContext = EvaluationContext{};
+    if (auto value =
+          ExpressionNode{Expression{optimizedExpression}}.evaluate(evaluationContext);
         value != Value::Undefined)
     {
-      values.push_back(std::move(value));
-    }
-    else
-    {
-      return ArrayExpression{std::move(optimizedExpressions) | kdl::to_vector};
+      return LiteralExpression{std::move(value)};
     }
   }
 
-  return LiteralExpression{Value{std::move(values)}};
+  return optimizedExpression;
 }
 
 Expression optimize(const MapExpression& expression)
@@ -930,22 +943,26 @@ Expression optimize(const MapExpression& expression)
   auto optimizedExpressions =
     expression.elements | std::views::transform([](const auto& entry) {
       return std::pair{entry.first, entry.second.optimize()};
-    });
+    })
+    | kdl::to<std::map<std::string, ExpressionNode>>();
 
   auto values = MapType{};
 
   const auto evaluationContext = EvaluationContext{};
   for (const auto& [key, element] : optimizedExpressions)
   {
+    if (!isLiteral(element))
+    {
+      return MapExpression{std::move(optimizedExpressions)};
+    }
+
     if (auto value = element.evaluate(evaluationContext); value != Value::Undefined)
     {
       values.emplace(key, std::move(value));
     }
     else
     {
-      return MapExpression{
-        std::move(optimizedExpressions)
-        | kdl::to<std::map<std::string, ExpressionNode>>()};
+      return MapExpression{std::move(optimizedExpressions)};
     }
   }
 
@@ -954,13 +971,16 @@ Expression optimize(const MapExpression& expression)
 
 Expression optimize(const UnaryExpression& expression)
 {
-  const auto evaluationContext = EvaluationContext{};
   auto optimizedOperand = expression.operand.optimize();
-  if (auto value = evaluateUnaryExpression(
-        expression.operation, optimizedOperand.evaluate(evaluationContext));
-      value != Value::Undefined)
+  if (isLiteral(optimizedOperand))
   {
-    return LiteralExpression{std::move(value)};
+    const auto evaluationContext = EvaluationContext{};
+    if (auto value = evaluateUnaryExpression(
+          expression.operation, optimizedOperand.evaluate(evaluationContext));
+        value != Value::Undefined)
+    {
+      return LiteralExpression{std::move(value)};
+    }
   }
 
   return UnaryExpression{expression.operation, std::move(optimizedOperand)};
@@ -973,19 +993,26 @@ Expression optimize(const BinaryExpression& expression)
 
   const auto evaluationContext = EvaluationContext{};
 
+  // Operands that are not literals yield undefined; the result is discarded below. The
+  // right operand is only evaluated if the operation does not short circuit.
+  const auto evaluateOperand = [&](const ExpressionNode& operand) {
+    return isLiteral(operand) ? operand.evaluate(evaluationContext) : Value::Undefined;
+  };
+
   const auto evaluateLeftOperand = [&] {
     optimizedLeftOperand = expression.leftOperand.optimize();
-    return optimizedLeftOperand->evaluate(evaluationContext);
+    return evaluateOperand(*optimizedLeftOperand);
   };
 
   const auto evaluateRightOperand = [&] {
     optimizedRightOperand = expression.rightOperand.optimize();
-    return optimizedRightOperand->evaluate(evaluationContext);
+    return evaluateOperand(*optimizedRightOperand);
   };
 
   if (auto value = evaluateBinaryExpression(
         expression.operation, evaluateLeftOperand, evaluateRightOperand);
-      value != Value::Undefined)
+      isLiteralOrNone(optimizedLeftOperand) && isLiteralOrNone(optimizedRightOperand)
+      && value != Value::Undefined)
   {
     return LiteralExpression{std::move(value)};
   }
@@ -1001,17 +1028,14 @@ Expression optimize(const SubscriptExpression& expression)
   auto optimizedLeftOperand = expression.leftOperand.optimize();
   auto optimizedRightOperand = expression.rightOperand.optimize();
 
-  const auto evaluationContext = EvaluationContext{};
-  if (auto leftValue = optimizedLeftOperand.evaluate(evaluationContext);
-      leftValue != Value::Undefined)
+  if (isLiteral(optimizedLeftOperand) && isLiteral(optimizedRightOperand))
   {
-    if (auto rightValue = optimizedRightOperand.evaluate(evaluationContext);
-        rightValue != Value::Undefined)
+    const auto evaluationContext = EvaluationContext{};
+    const auto leftValue = optimizedLeftOperand.evaluate(evaluationContext);
+    const auto rightValue = optimizedRightOperand.evaluate(evaluationContext);
+    if (auto value = leftValue[rightValue]; value != Value::Undefined)
     {
-      if (auto value = leftValue[rightValue]; value != Value::Undefined)
-      {
-        return LiteralExpression{std::move(value)};
-      }
+      return LiteralExpression{std::move(value)};
     }
   }
 
@@ -1021,24 +1045,34 @@ Expression optimize(const SubscriptExpression& expression)
 
 Expression optimize(const SwitchExpression& expression)
 {
-  if (expression.cases.empty())
-  {
-    return SwitchExpression{expression.cases};
-  }
-
   const auto evaluationContext = EvaluationContext{};
-  auto firstOptimizedExpression = expression.cases.front().optimize();
-  if (auto firstValue = firstOptimizedExpression.evaluate(evaluationContext);
-      firstValue != Value::Undefined)
-  {
-    return LiteralExpression{std::move(firstValue)};
-  }
 
-  auto optimizedExpressions =
-    std::vector<ExpressionNode>{std::move(firstOptimizedExpression)};
-  for (size_t i = 1u; i < expression.cases.size(); ++i)
+  auto optimizedExpressions = std::vector<ExpressionNode>{};
+  optimizedExpressions.reserve(expression.cases.size());
+
+  for (const auto& case_ : expression.cases)
   {
-    optimizedExpressions.push_back(expression.cases[i].optimize());
+    auto optimizedExpression = case_.optimize();
+    if (isLiteral(optimizedExpression))
+    {
+      auto value = optimizedExpression.evaluate(evaluationContext);
+      if (value == Value::Undefined)
+      {
+        // this case never matches
+        continue;
+      }
+
+      if (optimizedExpressions.empty())
+      {
+        return LiteralExpression{std::move(value)};
+      }
+
+      // this case always matches, so the remaining cases are unreachable
+      optimizedExpressions.push_back(std::move(optimizedExpression));
+      break;
+    }
+
+    optimizedExpressions.push_back(std::move(optimizedExpression));
   }
 
   return SwitchExpression{std::move(optimizedExpressions)};
@@ -1177,6 +1211,46 @@ ExpressionNode ExpressionNode::optimize() const
     std::make_shared<Expression>(optimizeExpression(*m_expression)), m_location};
 }
 
+std::vector<std::string> ExpressionNode::variableNames() const
+{
+  auto result = std::vector<std::string>{};
+  accept(kdl::overload(
+    [](const auto&, const LiteralExpression&) {},
+    [&](const auto&, const VariableExpression& variableExpression) {
+      result.push_back(variableExpression.variableName);
+    },
+    [](const auto& thisLambda, const ArrayExpression& arrayExpression) {
+      for (const auto& element : arrayExpression.elements)
+      {
+        element.accept(thisLambda);
+      }
+    },
+    [](const auto& thisLambda, const MapExpression& mapExpression) {
+      for (const auto& [key, element] : mapExpression.elements)
+      {
+        element.accept(thisLambda);
+      }
+    },
+    [](const auto& thisLambda, const UnaryExpression& unaryExpression) {
+      unaryExpression.operand.accept(thisLambda);
+    },
+    [](const auto& thisLambda, const BinaryExpression& binaryExpression) {
+      binaryExpression.leftOperand.accept(thisLambda);
+      binaryExpression.rightOperand.accept(thisLambda);
+    },
+    [](const auto& thisLambda, const SubscriptExpression& subscriptExpression) {
+      subscriptExpression.leftOperand.accept(thisLambda);
+      subscriptExpression.rightOperand.accept(thisLambda);
+    },
+    [](const auto& thisLambda, const SwitchExpression& switchExpression) {
+      for (const auto& case_ : switchExpression.cases)
+      {
+        case_.accept(thisLambda);
+      }
+    }));
+  return kdl::vec_sort_and_remove_duplicates(std::move(result));
+}
+
 const std::optional<FileLocation>& ExpressionNode::location() const
 {
   return m_location;
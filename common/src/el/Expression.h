@@ -125,6 +125,12 @@ public:
 
   ExpressionNode optimize() const;
 
+  /**
+   * Returns the names of all variables referenced by this expression, sorted and without
+   * duplicates. Evaluating this expression cannot depend on any other variables.
+   */
+  std::vector<std::string> variableNames() const;
+
   const std::optional<FileLocation>& location() const;
 
   std::string asString() const;
@@ -186,7 +186,7 @@ DefParser::TokenNameMap DefParser::tokenNames() const
   };
 }
 
-std::vector<EntityDefinitionClassInfo> DefParser::parseClassInfos(ParserStatus& status)
+std::vector<EntityDefinitionClassInfo> DefParser::doParseClassInfos(ParserStatus& status)
 {
   auto result = std::vector<EntityDefinitionClassInfo>{};
 
@@ -407,7 +407,7 @@ mdl::ModelDefinition DefParser::parseModelDefinition(ParserStatus& status)
     m_tokenizer.adoptState(parser.tokenizerState());
     expect(status, DefToken::CParenthesis, m_tokenizer.nextToken());
 
-    expression.optimize();
+    expression = expression.optimize();
     return mdl::ModelDefinition{std::move(expression)};
   }
   catch (const ParserException& e)
@@ -423,7 +423,7 @@ mdl::ModelDefinition DefParser::parseModelDefinition(ParserStatus& status)
       m_tokenizer.adoptState(parser.tokenizerState());
       expect(status, DefToken::CParenthesis, m_tokenizer.nextToken());
 
-      expression.optimize();
+      expression = expression.optimize();
       status.warn(
         location,
         fmt::format(
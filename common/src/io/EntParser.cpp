@@ -595,7 +595,7 @@ mdl::ModelDefinition parseModel(const tinyxml2::XMLElement& element)
   {
     auto parser = ELParser{ELParser::Mode::Lenient, model};
     auto expression = parser.parse();
-    expression.optimize();
+    expression = expression.optimize();
     return mdl::ModelDefinition{std::move(expression)};
   }
   catch (const ParserException&)
@@ -714,7 +714,7 @@ EntParser::EntParser(std::string_view str, const Color& defaultEntityColor)
 {
 }
 
-std::vector<EntityDefinitionClassInfo> EntParser::parseClassInfos(ParserStatus& status)
+std::vector<EntityDefinitionClassInfo> EntParser::doParseClassInfos(ParserStatus& status)
 {
   auto doc = tinyxml2::XMLDocument{};
   doc.Parse(m_str.data(), m_str.length());
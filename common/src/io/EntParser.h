@@ -38,7 +38,7 @@ public:
   EntParser(std::string_view str, const Color& defaultEntityColor);
 
 private:
-  std::vector<EntityDefinitionClassInfo> parseClassInfos(ParserStatus& status) override;
+  std::vector<EntityDefinitionClassInfo> doParseClassInfos(ParserStatus& status) override;
 };
 
 } // namespace tb::io
@@ -0,0 +1,116 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EntityDefinitionClassInfoCache.h"
+
+#include "io/DiskIO.h"
+#include "io/File.h"
+#include "io/Reader.h"
+
+#include "kdl/result.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace tb::io
+{
+namespace
+{
+
+std::size_t hashContents(const std::string_view contents)
+{
+  return std::hash<std::string_view>{}(contents);
+}
+
+std::optional<std::size_t> hashFile(const std::filesystem::path& path)
+{
+  return Disk::openFile(path) | kdl::transform([](auto file) {
+           auto reader = file->reader().buffer();
+           return std::optional{hashContents(reader.stringView())};
+         })
+         | kdl::transform_error([](auto) { return std::optional<std::size_t>{}; })
+         | kdl::value();
+}
+
+} // namespace
+
+std::optional<std::vector<EntityDefinitionClassInfo>> EntityDefinitionClassInfoCache::
+  find(
+    ParserStatus& status,
+    const std::filesystem::path& path,
+    const std::string_view contents) const
+{
+  const auto lock = std::lock_guard{m_mutex};
+
+  const auto it = m_entries.find(path);
+  if (it == m_entries.end())
+  {
+    return std::nullopt;
+  }
+
+  const auto& entry = it->second;
+  if (
+    entry.contentHash != hashContents(contents)
+    || !std::all_of(
+      entry.includes.begin(), entry.includes.end(), [](const auto& include) {
+        return hashFile(include.first) == include.second;
+      }))
+  {
+    return std::nullopt;
+  }
+
+  for (const auto& message : entry.messages)
+  {
+    status.replay(message);
+  }
+  return entry.classInfos;
+}
+
+void EntityDefinitionClassInfoCache::insert(
+  const std::filesystem::path& path,
+  const std::string_view contents,
+  const std::vector<std::filesystem::path>& includedPaths,
+  std::vector<EntityDefinitionClassInfo> classInfos,
+  std::vector<ParserStatusMessage> messages)
+{
+  auto includes =
+    std::vector<std::pair<std::filesystem::path, std::optional<std::size_t>>>{};
+  includes.reserve(includedPaths.size());
+  for (const auto& includedPath : includedPaths)
+  {
+    includes.emplace_back(includedPath, hashFile(includedPath));
+  }
+
+  const auto lock = std::lock_guard{m_mutex};
+  m_entries.insert_or_assign(
+    path,
+    Entry{
+      hashContents(contents),
+      std::move(includes),
+      std::move(classInfos),
+      std::move(messages)});
+}
+
+void EntityDefinitionClassInfoCache::clear()
+{
+  const auto lock = std::lock_guard{m_mutex};
+  m_entries.clear();
+}
+
+} // namespace tb::io
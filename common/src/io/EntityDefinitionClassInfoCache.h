@@ -0,0 +1,92 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "io/EntityDefinitionClassInfo.h"
+#include "io/ParserStatus.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace tb::io
+{
+
+/**
+ * Caches the class infos parsed from entity definition files. An entry is identified by
+ * the path of the parsed file and remains valid as long as the contents of that file and
+ * of all files it included are unchanged. Included files that could not be read are
+ * recorded as absent, so the entry becomes invalid once they appear.
+ *
+ * Only the class infos are cached, the entity definitions must still be created from
+ * them because they are owned by the entity definition manager. The messages logged
+ * while parsing are cached too and replayed whenever the entry is used, so that problems
+ * in the files are reported every time they are loaded.
+ */
+class EntityDefinitionClassInfoCache
+{
+private:
+  struct Entry
+  {
+    std::size_t contentHash;
+    std::vector<std::pair<std::filesystem::path, std::optional<std::size_t>>> includes;
+    std::vector<EntityDefinitionClassInfo> classInfos;
+    std::vector<ParserStatusMessage> messages;
+  };
+
+  mutable std::mutex m_mutex;
+  std::map<std::filesystem::path, Entry> m_entries;
+
+public:
+  /**
+   * Returns the cached class infos for the file at the given path if the file and its
+   * included files have not changed since they were parsed. On a hit, the messages that
+   * were logged while parsing are replayed to the given status.
+   *
+   * @param status the status to replay the cached messages to
+   * @param path the path of the file
+   * @param contents the current contents of the file
+   */
+  std::optional<std::vector<EntityDefinitionClassInfo>> find(
+    ParserStatus& status,
+    const std::filesystem::path& path,
+    std::string_view contents) const;
+
+  /**
+   * Caches the class infos parsed from the file at the given path together with the
+   * messages that were logged while parsing it. The included files are read again to
+   * record their contents. Included files that cannot be read are recorded as absent.
+   */
+  void insert(
+    const std::filesystem::path& path,
+    std::string_view contents,
+    const std::vector<std::filesystem::path>& includedPaths,
+    std::vector<EntityDefinitionClassInfo> classInfos,
+    std::vector<ParserStatusMessage> messages);
+
+  void clear();
+};
+
+} // namespace tb::io
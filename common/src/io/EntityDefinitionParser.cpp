@@ -420,26 +420,6 @@ std::unique_ptr<mdl::EntityDefinition> createDefinition(
   };
 }
 
-std::vector<std::unique_ptr<mdl::EntityDefinition>> createDefinitions(
-  ParserStatus& status,
-  const std::vector<EntityDefinitionClassInfo>& classInfos,
-  const Color& defaultEntityColor)
-{
-  const auto resolvedClasses =
-    resolveInheritance(status, filterRedundantClasses(status, classInfos));
-
-  auto result = std::vector<std::unique_ptr<mdl::EntityDefinition>>{};
-  for (auto classInfo : resolvedClasses)
-  {
-    if (auto definition = createDefinition(std::move(classInfo), defaultEntityColor))
-    {
-      result.push_back(std::move(definition));
-    }
-  }
-
-  return result;
-}
-
 } // namespace
 
 /**
@@ -468,6 +448,26 @@ std::vector<EntityDefinitionClassInfo> resolveInheritance(
          | kdl::to_vector;
 }
 
+std::vector<std::unique_ptr<mdl::EntityDefinition>> createEntityDefinitions(
+  ParserStatus& status,
+  const std::vector<EntityDefinitionClassInfo>& classInfos,
+  const Color& defaultEntityColor)
+{
+  const auto resolvedClasses =
+    resolveInheritance(status, filterRedundantClasses(status, classInfos));
+
+  auto result = std::vector<std::unique_ptr<mdl::EntityDefinition>>{};
+  for (auto classInfo : resolvedClasses)
+  {
+    if (auto definition = createDefinition(std::move(classInfo), defaultEntityColor))
+    {
+      result.push_back(std::move(definition));
+    }
+  }
+
+  return result;
+}
+
 EntityDefinitionParser::EntityDefinitionParser(const Color& defaultEntityColor)
   : m_defaultEntityColor{defaultEntityColor}
 {
@@ -479,7 +479,13 @@ std::vector<std::unique_ptr<mdl::EntityDefinition>> EntityDefinitionParser::
   parseDefinitions(ParserStatus& status)
 {
   const auto classInfos = parseClassInfos(status);
-  return createDefinitions(status, classInfos, m_defaultEntityColor);
+  return createEntityDefinitions(status, classInfos, m_defaultEntityColor);
+}
+
+std::vector<EntityDefinitionClassInfo> EntityDefinitionParser::parseClassInfos(
+  ParserStatus& status)
+{
+  return doParseClassInfos(status);
 }
 
 } // namespace tb::io
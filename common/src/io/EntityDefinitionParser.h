@@ -39,6 +39,11 @@ class ParserStatus;
 std::vector<EntityDefinitionClassInfo> resolveInheritance(
   ParserStatus& status, const std::vector<EntityDefinitionClassInfo>& classInfos);
 
+std::vector<std::unique_ptr<mdl::EntityDefinition>> createEntityDefinitions(
+  ParserStatus& status,
+  const std::vector<EntityDefinitionClassInfo>& classInfos,
+  const Color& defaultEntityColor);
+
 class EntityDefinitionParser
 {
 private:
@@ -50,9 +55,10 @@ public:
 
   std::vector<std::unique_ptr<mdl::EntityDefinition>> parseDefinitions(
     ParserStatus& status);
+  std::vector<EntityDefinitionClassInfo> parseClassInfos(ParserStatus& status);
 
 private:
-  virtual std::vector<EntityDefinitionClassInfo> parseClassInfos(
+  virtual std::vector<EntityDefinitionClassInfo> doParseClassInfos(
     ParserStatus& status) = 0;
 };
 
@@ -171,6 +171,11 @@ FgdParser::FgdParser(std::string_view str, const Color& defaultEntityColor)
 
 FgdParser::~FgdParser() = default;
 
+const std::vector<std::filesystem::path>& FgdParser::includedPaths() const
+{
+  return m_includedPaths;
+}
+
 FgdParser::TokenNameMap FgdParser::tokenNames() const
 {
   using namespace FgdToken;
@@ -232,7 +237,7 @@ bool FgdParser::isRecursiveInclude(const std::filesystem::path& path) const
   });
 }
 
-std::vector<EntityDefinitionClassInfo> FgdParser::parseClassInfos(ParserStatus& status)
+std::vector<EntityDefinitionClassInfo> FgdParser::doParseClassInfos(ParserStatus& status)
 {
   auto classInfos = std::vector<EntityDefinitionClassInfo>{};
   auto token = m_tokenizer.peekToken();
@@ -480,7 +485,7 @@ mdl::ModelDefinition FgdParser::parseModel(
     m_tokenizer.adoptState(parser.tokenizerState());
     expect(status, FgdToken::CParenthesis, m_tokenizer.nextToken());
 
-    expression.optimize();
+    expression = expression.optimize();
     return mdl::ModelDefinition{std::move(expression)};
   }
   catch (const ParserException& e)
@@ -496,7 +501,7 @@ mdl::ModelDefinition FgdParser::parseModel(
       m_tokenizer.adoptState(parser.tokenizerState());
       expect(status, FgdToken::CParenthesis, m_tokenizer.nextToken());
 
-      expression.optimize();
+      expression = expression.optimize();
       status.warn(
         location,
         fmt::format(
@@ -1067,7 +1072,11 @@ std::vector<EntityDefinitionClassInfo> FgdParser::handleInclude(
   status.debug(
     m_tokenizer.location(), fmt::format("Parsing included file '{}'", path.string()));
 
+  // Record the path even if the file cannot be opened so that callers can notice when it
+  // appears later.
   const auto filePath = currentRoot() / path;
+  m_includedPaths.push_back(m_fs->makeAbsolute(filePath) | kdl::value_or(filePath));
+
   return m_fs->openFile(filePath) | kdl::transform([&](auto file) {
            status.debug(
              m_tokenizer.location(),
@@ -85,6 +85,7 @@ private:
   using Token = FgdTokenizer::Token;
 
   std::vector<std::filesystem::path> m_paths;
+  std::vector<std::filesystem::path> m_includedPaths;
   std::unique_ptr<FileSystem> m_fs;
 
   FgdTokenizer m_tokenizer;
@@ -98,6 +99,13 @@ public:
 
   ~FgdParser() override;
 
+  /**
+   * Returns the absolute paths of all files that were included while parsing, in the
+   * order in which they were included. This includes the paths of included files that
+   * could not be opened.
+   */
+  const std::vector<std::filesystem::path>& includedPaths() const;
+
 private:
   class PushIncludePath;
   void pushIncludePath(std::filesystem::path path);
@@ -109,7 +117,7 @@ private:
 private:
   TokenNameMap tokenNames() const override;
 
-  std::vector<EntityDefinitionClassInfo> parseClassInfos(ParserStatus& status) override;
+  std::vector<EntityDefinitionClassInfo> doParseClassInfos(ParserStatus& status) override;
 
   void parseClassInfoOrInclude(
     ParserStatus& status, std::vector<EntityDefinitionClassInfo>& classInfos);
@@ -26,6 +26,7 @@
 #include "io/DkmLoader.h"
 #include "io/FileSystem.h"
 #include "io/ImageSpriteLoader.h"
+#include "io/LoadMaterialCollections.h"
 #include "io/Md2Loader.h"
 #include "io/Md3Loader.h"
 #include "io/MdlLoader.h"
@@ -43,16 +44,9 @@ namespace tb::io
 namespace
 {
 
-auto loadPalette(const FileSystem& fs, const mdl::MaterialConfig& materialConfig)
-{
-  const auto& path = materialConfig.palette;
-  return fs.openFile(path)
-         | kdl::and_then([&](auto file) { return mdl::loadPalette(*file, path); });
-}
-
 Result<mdl::EntityModelData> loadEntityModelData(
   const FileSystem& fs,
-  const mdl::MaterialConfig& materialConfig,
+  const Result<mdl::Palette>& paletteResult,
   const std::filesystem::path& path,
   const LoadMaterialFunc& loadMaterial,
   Logger& logger)
@@ -64,28 +58,28 @@ Result<mdl::EntityModelData> loadEntityModelData(
 
              if (io::MdlLoader::canParse(path, reader))
              {
-               return loadPalette(fs, materialConfig) | kdl::and_then([&](auto palette) {
+               return paletteResult | kdl::and_then([&](const auto& palette) {
                         auto loader = io::MdlLoader{modelName, reader, palette};
                         return loader.load(logger);
                       });
              }
              if (io::Md2Loader::canParse(path, reader))
              {
-               return loadPalette(fs, materialConfig) | kdl::and_then([&](auto palette) {
+               return paletteResult | kdl::and_then([&](const auto& palette) {
                         auto loader = io::Md2Loader{modelName, reader, palette, fs};
                         return loader.load(logger);
                       });
              }
              if (io::BspLoader::canParse(path, reader))
              {
-               return loadPalette(fs, materialConfig) | kdl::and_then([&](auto palette) {
+               return paletteResult | kdl::and_then([&](const auto& palette) {
                         auto loader = io::BspLoader{modelName, reader, palette, fs};
                         return loader.load(logger);
                       });
              }
              if (io::SprLoader::canParse(path, reader))
              {
-               return loadPalette(fs, materialConfig) | kdl::and_then([&](auto palette) {
+               return paletteResult | kdl::and_then([&](const auto& palette) {
                         auto loader = io::SprLoader{modelName, reader, palette};
                         return loader.load(logger);
                       });
@@ -130,13 +124,13 @@ Result<mdl::EntityModelData> loadEntityModelData(
 
 mdl::ResourceLoader<mdl::EntityModelData> makeEntityModelDataResourceLoader(
   const FileSystem& fs,
-  const mdl::MaterialConfig& materialConfig,
+  const Result<mdl::Palette>& paletteResult,
   const std::filesystem::path& path,
   const LoadMaterialFunc& loadMaterial,
   Logger& logger)
 {
-  return [&fs, materialConfig, path, loadMaterial, &logger]() {
-    return loadEntityModelData(fs, materialConfig, path, loadMaterial, logger);
+  return [&fs, paletteResult, path, loadMaterial, &logger]() {
+    return loadEntityModelData(fs, paletteResult, path, loadMaterial, logger);
   };
 }
 
@@ -149,7 +143,8 @@ Result<mdl::EntityModel> loadEntityModelSync(
   const LoadMaterialFunc& loadMaterial,
   Logger& logger)
 {
-  return loadEntityModelData(fs, materialConfig, path, loadMaterial, logger)
+  const auto paletteResult = loadPalette(fs, materialConfig);
+  return loadEntityModelData(fs, paletteResult, path, loadMaterial, logger)
          | kdl::transform([&](auto modelData) {
              auto modelName = path.filename().string();
              auto modelResource =
@@ -160,7 +155,7 @@ Result<mdl::EntityModel> loadEntityModelSync(
 
 mdl::EntityModel loadEntityModelAsync(
   const FileSystem& fs,
-  const mdl::MaterialConfig& materialConfig,
+  const Result<mdl::Palette>& paletteResult,
   const std::filesystem::path& path,
   const LoadMaterialFunc& loadMaterial,
   const mdl::CreateEntityModelDataResource& createResource,
@@ -168,7 +163,7 @@ mdl::EntityModel loadEntityModelAsync(
 {
   auto name = path.filename().string();
   auto loader =
-    makeEntityModelDataResourceLoader(fs, materialConfig, path, loadMaterial, logger);
+    makeEntityModelDataResourceLoader(fs, paletteResult, path, loadMaterial, logger);
   auto resource = createResource(std::move(loader));
   return mdl::EntityModel{std::move(name), std::move(resource)};
 }
@@ -21,6 +21,7 @@
 
 #include "Result.h"
 #include "mdl/EntityModelDataResource.h"
+#include "mdl/Palette.h"
 
 #include <filesystem>
 #include <functional>
@@ -50,9 +51,14 @@ Result<mdl::EntityModel> loadEntityModelSync(
   const LoadMaterialFunc& loadMaterial,
   Logger& logger);
 
+/**
+ * Creates an entity model whose data is loaded by the given resource. Models that
+ * need a palette use the given palette, which allows callers to load it only once for
+ * all models.
+ */
 mdl::EntityModel loadEntityModelAsync(
   const FileSystem& fs,
-  const mdl::MaterialConfig& materialConfig,
+  const Result<mdl::Palette>& paletteResult,
   const std::filesystem::path& path,
   const LoadMaterialFunc& loadMaterial,
   const mdl::CreateEntityModelDataResource& createResource,
@@ -61,19 +61,6 @@ namespace tb::io
 namespace
 {
 
-Result<mdl::Palette> loadPalette(
-  const FileSystem& fs, const mdl::MaterialConfig& materialConfig)
-{
-  if (materialConfig.palette.empty())
-  {
-    return Error{"Material config is missing palette definition"};
-  }
-
-  return fs.openFile(materialConfig.palette) | kdl::and_then([&](auto file) {
-           return mdl::loadPalette(*file, materialConfig.palette);
-         });
-}
-
 bool shouldExclude(
   const std::string& materialName, const std::vector<std::string>& patterns)
 {
@@ -404,6 +391,19 @@ Result<mdl::Material> loadMaterial(
            });
 }
 
+Result<mdl::Palette> loadPalette(
+  const FileSystem& fs, const mdl::MaterialConfig& materialConfig)
+{
+  if (materialConfig.palette.empty())
+  {
+    return Error{"Material config is missing palette definition"};
+  }
+
+  return fs.openFile(materialConfig.palette) | kdl::and_then([&](auto file) {
+           return mdl::loadPalette(*file, materialConfig.palette);
+         });
+}
+
 Result<std::vector<mdl::MaterialCollection>> loadMaterialCollections(
   const FileSystem& fs,
   const mdl::MaterialConfig& materialConfig,
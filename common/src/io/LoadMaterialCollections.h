@@ -44,6 +44,9 @@ namespace tb::io
 {
 class FileSystem;
 
+Result<mdl::Palette> loadPalette(
+  const FileSystem& fs, const mdl::MaterialConfig& materialConfig);
+
 Result<mdl::Material> loadMaterial(
   const FileSystem& fs,
   const mdl::MaterialConfig& materialConfig,
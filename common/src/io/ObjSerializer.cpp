@@ -253,10 +253,11 @@ void ObjSerializer::doBrushFace(const mdl::BrushFace& face)
   auto indexedVertices = std::vector<IndexedVertex>{};
   indexedVertices.reserve(face.vertexCount());
 
+  const auto uvProjection = face.uvProjection();
   for (const auto* vertex : face.vertices())
   {
     const auto& position = vertex->position();
-    const auto uvCoords = face.uvCoords(position);
+    const auto uvCoords = uvProjection.uvCoords(position);
 
     const auto vertexIndex = m_vertices.index(position);
     const auto uvCoordsIndex = m_uvCoords.index(uvCoords);
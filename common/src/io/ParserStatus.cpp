@@ -95,6 +95,11 @@ void ParserStatus::errorAndThrow(const std::string& str)
   throw ParserException(buildMessage(str));
 }
 
+void ParserStatus::replay(const ParserStatusMessage& message)
+{
+  doLog(message.level, message.message);
+}
+
 void ParserStatus::log(
   const LogLevel level, const FileLocation& location, const std::string& str)
 {
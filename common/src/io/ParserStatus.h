@@ -30,6 +30,16 @@ enum class LogLevel;
 
 namespace tb::io
 {
+
+/**
+ * A message that was logged by a parser status, including its prefix and location.
+ */
+struct ParserStatusMessage
+{
+  LogLevel level;
+  std::string message;
+};
+
 class ParserStatus
 {
 private:
@@ -38,6 +48,7 @@ private:
 
 protected:
   ParserStatus(Logger& logger, std::string prefix);
+  ParserStatus(const ParserStatus& other) = default;
 
 public:
   virtual ~ParserStatus();
@@ -57,6 +68,12 @@ public:
   void error(const std::string& str);
   [[noreturn]] void errorAndThrow(const std::string& str);
 
+  /**
+   * Logs the given message again, e.g. when a parse is skipped because its results were
+   * cached. The message is not changed.
+   */
+  void replay(const ParserStatusMessage& message);
+
 private:
   void log(LogLevel level, const FileLocation& location, const std::string& str);
   std::string buildMessage(const FileLocation& location, const std::string& str) const;
@@ -0,0 +1,49 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "RecordingParserStatus.h"
+
+#include <string>
+
+namespace tb::io
+{
+
+RecordingParserStatus::RecordingParserStatus(ParserStatus& status)
+  : ParserStatus{status}
+  , m_status{status}
+{
+}
+
+const std::vector<ParserStatusMessage>& RecordingParserStatus::messages() const
+{
+  return m_messages;
+}
+
+void RecordingParserStatus::doProgress(const double progress)
+{
+  m_status.progress(progress);
+}
+
+void RecordingParserStatus::doLog(const LogLevel level, const std::string& str)
+{
+  auto message = ParserStatusMessage{level, str};
+  m_status.replay(message);
+  m_messages.push_back(std::move(message));
+}
+
+} // namespace tb::io
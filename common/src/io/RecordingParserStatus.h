@@ -0,0 +1,48 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "io/ParserStatus.h"
+
+#include <vector>
+
+namespace tb::io
+{
+
+/**
+ * Forwards everything to another parser status and records the logged messages so that
+ * they can be replayed later, see ParserStatus::replay.
+ */
+class RecordingParserStatus : public ParserStatus
+{
+private:
+  ParserStatus& m_status;
+  std::vector<ParserStatusMessage> m_messages;
+
+public:
+  explicit RecordingParserStatus(ParserStatus& status);
+
+  const std::vector<ParserStatusMessage>& messages() const;
+
+private:
+  void doProgress(double progress) override;
+  void doLog(LogLevel level, const std::string& str) override;
+};
+
+} // namespace tb::io
@@ -28,7 +28,9 @@
 #include "vm/bezier_surface.h"
 #include "vm/vec_io.h" // IWYU pragma: keep
 
+#include <array>
 #include <cassert>
+#include <optional>
 
 namespace tb::mdl
 {
@@ -306,8 +308,17 @@ std::vector<BezierPatch::Point> BezierPatch::evaluate(
   |    surface row index
   |
   value of v
+
+  Evaluating a surface at (u, v) evaluates each of its three rows of control points at u,
+  and then evaluates the resulting curve at v. Since the row curves don't depend on v, we
+  evaluate them once for each grid column and surface row and reuse them for every grid
+  row that samples the same surface row.
   */
 
+  auto rowCurvePoints = std::vector<std::array<BezierPatch::Point, 3u>>{};
+  rowCurvePoints.resize(gridPointColumnCount);
+  auto currentSurfaceRow = std::optional<size_t>{};
+
   for (size_t gridRow = 0u; gridRow < gridPointRowCount; ++gridRow)
   {
     const size_t surfaceRow =
@@ -315,17 +326,29 @@ std::vector<BezierPatch::Point> BezierPatch::evaluate(
     const double v = static_cast<double>(gridRow - surfaceRow * quadsPerSurfaceSide)
                      / static_cast<double>(quadsPerSurfaceSide);
 
+    if (surfaceRow != currentSurfaceRow)
+    {
+      for (size_t gridCol = 0u; gridCol < gridPointColumnCount; ++gridCol)
+      {
+        const size_t surfaceCol =
+          (gridCol > 0u ? gridCol - 1u : gridCol) / quadsPerSurfaceSide;
+        const double u = static_cast<double>(gridCol - surfaceCol * quadsPerSurfaceSide)
+                         / static_cast<double>(quadsPerSurfaceSide);
+
+        const auto& surfaceControlPoints =
+          allSurfaceControlPoints[surfaceRow * surfaceColumnCount() + surfaceCol];
+        rowCurvePoints[gridCol] = {
+          vm::evaluate_quadratic_bezier_curve(surfaceControlPoints[0], u),
+          vm::evaluate_quadratic_bezier_curve(surfaceControlPoints[1], u),
+          vm::evaluate_quadratic_bezier_curve(surfaceControlPoints[2], u),
+        };
+      }
+      currentSurfaceRow = surfaceRow;
+    }
+
     for (size_t gridCol = 0u; gridCol < gridPointColumnCount; ++gridCol)
     {
-      const size_t surfaceCol =
-        (gridCol > 0u ? gridCol - 1u : gridCol) / quadsPerSurfaceSide;
-      const double u = static_cast<double>(gridCol - surfaceCol * quadsPerSurfaceSide)
-                       / static_cast<double>(quadsPerSurfaceSide);
-
-      const auto& surfaceControlPoints =
-        allSurfaceControlPoints[surfaceRow * surfaceColumnCount() + surfaceCol];
-      auto point = vm::evaluate_quadratic_bezier_surface(surfaceControlPoints, u, v);
-      grid.push_back(std::move(point));
+      grid.push_back(vm::evaluate_quadratic_bezier_curve(rowCurvePoints[gridCol], v));
     }
   }
 
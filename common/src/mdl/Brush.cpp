@@ -50,35 +50,16 @@ namespace tb::mdl
 
 kdl_reflect_impl(Brush);
 
-class Brush::CopyCallback : public BrushGeometry::CopyCallback
-{
-public:
-  void faceWasCopied(
-    const BrushFaceGeometry* original, BrushFaceGeometry* copy) const override
-  {
-    copy->setPayload(original->payload());
-  }
-};
-
 Brush::Brush() {}
 
 Brush::Brush(const Brush& other)
   : m_faces{other.m_faces}
-  , m_geometry{
-      other.m_geometry
-        ? std::make_unique<BrushGeometry>(*other.m_geometry, CopyCallback())
-        : nullptr}
+  , m_geometry{other.m_geometry}
 {
-  if (m_geometry)
+  // copied faces are not linked to any geometry, but they can share ours
+  for (size_t i = 0; i < m_faces.size(); ++i)
   {
-    for (BrushFaceGeometry* faceGeometry : m_geometry->faces())
-    {
-      if (const auto faceIndex = faceGeometry->payload())
-      {
-        BrushFace& face = m_faces[*faceIndex];
-        face.setGeometry(faceGeometry);
-      }
-    }
+    m_faces[i].setGeometry(other.m_faces[i].geometry());
   }
 }
 
@@ -111,7 +92,7 @@ Result<void> Brush::updateGeometryFromFaces(const vm::bbox3d& worldBounds)
   // First, add all faces to the brush geometry
   BrushFace::sortFaces(m_faces);
 
-  auto geometry = std::make_unique<BrushGeometry>(worldBounds);
+  auto geometry = std::make_shared<BrushGeometry>(worldBounds);
 
   for (size_t i = 0u; i < m_faces.size(); ++i)
   {
@@ -393,6 +374,12 @@ Result<void> Brush::expand(
   return updateGeometryFromFaces(worldBounds);
 }
 
+bool Brush::isGeometryShared() const
+{
+  ensure(m_geometry != nullptr, "geometry is null");
+  return m_geometry.use_count() > 1;
+}
+
 size_t Brush::vertexCount() const
 {
   ensure(m_geometry != nullptr, "geometry is null");
@@ -1121,30 +1108,123 @@ Result<void> Brush::updateFacesFromGeometry(
   return updateGeometryFromFaces(worldBounds);
 }
 
+static double computeVolume(const BrushGeometry& geometry)
+{
+  // sum up the signed volumes of the tetrahedra formed by the origin and a fan
+  // triangulation of each face
+  auto volume = 0.0;
+  for (const auto* face : geometry.faces())
+  {
+    const auto& boundary = face->boundary();
+    const auto* first = boundary.front();
+    const auto& p0 = first->origin()->position();
+    for (const auto* edge = first->next(); edge->next() != first; edge = edge->next())
+    {
+      const auto& p1 = edge->origin()->position();
+      const auto& p2 = edge->next()->origin()->position();
+      volume += vm::dot(p0, vm::cross(p1, p2));
+    }
+  }
+  return vm::abs(volume) / 6.0;
+}
+
+/**
+ * Merges pairs of the given fragments whose union is convex until no such pair remains.
+ * Two fragments can be merged if the volume of their convex hull equals the sum of their
+ * volumes.
+ */
+static std::vector<BrushGeometry> mergeFragments(std::vector<BrushGeometry> fragments)
+{
+  // merging is quadratic in the number of fragments, so skip pathological cases
+  constexpr auto MaxMergeFragments = size_t(64);
+  constexpr auto VolumeEpsilon = 1e-9;
+  if (fragments.size() < 2 || fragments.size() > MaxMergeFragments)
+  {
+    return fragments;
+  }
+
+  auto volumes = kdl::vec_transform(fragments, computeVolume);
+
+  for (size_t i = 0; i < fragments.size(); ++i)
+  {
+    for (size_t j = i + 1; j < fragments.size(); ++j)
+    {
+      if (!fragments[i].bounds().intersects(fragments[j].bounds()))
+      {
+        continue;
+      }
+
+      auto hull = BrushGeometry{kdl::vec_concat(
+        fragments[i].vertexPositions(), fragments[j].vertexPositions())};
+      if (!hull.polyhedron())
+      {
+        continue;
+      }
+
+      const auto hullVolume = computeVolume(hull);
+      const auto volumeError = vm::abs(hullVolume - volumes[i] - volumes[j]);
+      if (volumeError <= VolumeEpsilon * hullVolume)
+      {
+        fragments[i] = std::move(hull);
+        volumes[i] = hullVolume;
+        fragments.erase(std::next(fragments.begin(), std::ptrdiff_t(j)));
+        volumes.erase(std::next(volumes.begin(), std::ptrdiff_t(j)));
+
+        // the merged fragment might now be mergeable with a fragment we already skipped
+        j = i;
+      }
+    }
+  }
+
+  return fragments;
+}
+
 std::vector<Result<Brush>> Brush::subtract(
   const MapFormat mapFormat,
   const vm::bbox3d& worldBounds,
   const std::string& defaultMaterialName,
   const std::vector<const Brush*>& subtrahends) const
 {
+  // subtrahends that don't overlap this brush can neither change the result nor
+  // contribute any face attributes
+  const auto overlappingSubtrahends =
+    kdl::vec_filter(subtrahends, [&](const auto* subtrahend) {
+      return bounds().intersects(subtrahend->bounds());
+    });
+
   auto result = std::vector<BrushGeometry>{*m_geometry};
 
-  for (const auto* subtrahend : subtrahends)
+  for (const auto* subtrahend : overlappingSubtrahends)
   {
     auto nextResults = std::vector<BrushGeometry>{};
+    nextResults.reserve(result.size());
 
-    for (const BrushGeometry& fragment : result)
+    for (BrushGeometry& fragment : result)
     {
-      auto subFragments = fragment.subtract(*subtrahend->m_geometry);
-      nextResults = kdl::vec_concat(std::move(nextResults), std::move(subFragments));
+      if (fragment.bounds().intersects(subtrahend->bounds()))
+      {
+        auto subFragments = fragment.subtract(*subtrahend->m_geometry);
+        nextResults = kdl::vec_concat(std::move(nextResults), std::move(subFragments));
+      }
+      else
+      {
+        nextResults.push_back(std::move(fragment));
+      }
     }
 
     result = std::move(nextResults);
   }
 
+  // Subtracting several overlapping subtrahends one after another tends to split the
+  // fragments more than necessary.
+  if (overlappingSubtrahends.size() > 1)
+  {
+    result = mergeFragments(std::move(result));
+  }
+
   return kdl::vec_transform(result, [&](const auto& geometry) {
     return createBrush(
-      mapFormat, worldBounds, defaultMaterialName, geometry, subtrahends);
+      mapFormat, worldBounds, defaultMaterialName, geometry, overlappingSubtrahends);
   });
 }
 
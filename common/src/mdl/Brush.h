@@ -46,8 +46,6 @@ enum class MapFormat;
 class Brush
 {
 private:
-  class CopyCallback;
-
   /**
    * Epsilon value to use when finding a vertex after applying a vertex operation
    */
@@ -59,7 +57,13 @@ public:
 
 private:
   std::vector<BrushFace> m_faces;
-  std::unique_ptr<BrushGeometry> m_geometry;
+
+  /**
+   * The geometry is never modified after it was built. Every operation that changes the
+   * shape of a brush builds a new geometry instead, so copies of a brush share their
+   * geometry and copying a brush does not copy the polyhedron.
+   */
+  std::shared_ptr<BrushGeometry> m_geometry;
 
   kdl_reflect_decl(Brush, m_faces);
 
@@ -145,6 +149,12 @@ public: // move face along normal
 
 public:
   // geometry access
+
+  /**
+   * Indicates whether this brush shares its geometry with another copy of it.
+   */
+  bool isGeometryShared() const;
+
   size_t vertexCount() const;
   const VertexList& vertices() const;
   const std::vector<vm::vec3d> vertexPositions() const;
@@ -808,9 +808,14 @@ void BrushFace::deselect()
   m_selected = false;
 }
 
+UVProjection BrushFace::uvProjection() const
+{
+  return m_uvCoordSystem->projection(m_attributes, textureSize());
+}
+
 vm::vec2f BrushFace::uvCoords(const vm::vec3d& point) const
 {
-  return m_uvCoordSystem->uvCoords(point, m_attributes, textureSize());
+  return uvProjection().uvCoords(point);
 }
 
 std::optional<double> BrushFace::intersectWithRay(const vm::ray3d& ray) const
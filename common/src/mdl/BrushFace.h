@@ -24,6 +24,7 @@
 #include "mdl/BrushFaceAttributes.h"
 #include "mdl/BrushGeometry.h"
 #include "mdl/Tag.h"
+#include "mdl/UVProjection.h"
 
 #include "kdl/reflection_decl.h"
 
@@ -264,6 +265,13 @@ public:
   void select();
   void deselect();
 
+  /**
+   * Returns a projection that computes the UV coordinates of this face. Prefer this over
+   * calling uvCoords repeatedly when UV coordinates are needed for many points.
+   *
+   * The returned projection must be discarded when this face changes.
+   */
+  UVProjection uvProjection() const;
   vm::vec2f uvCoords(const vm::vec3d& point) const;
 
   std::optional<double> intersectWithRay(const vm::ray3d& ray) const;
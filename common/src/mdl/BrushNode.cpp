@@ -42,6 +42,7 @@
 #include "vm/vec.h"
 
 #include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -54,6 +55,7 @@ BrushNode::BrushNode(Brush brush)
   , m_brush(std::move(brush))
 {
   clearSelectedFaces();
+  updateFaceTagMasks();
 }
 
 BrushNode::~BrushNode() = default;
@@ -98,6 +100,7 @@ Brush BrushNode::setBrush(Brush brush)
   swap(m_brush, brush);
 
   updateSelectedFaceCount();
+  updateFaceTagMasks();
   invalidateIssues();
   invalidateVertexCache();
 
@@ -124,6 +127,7 @@ void BrushNode::deselectFace(const size_t faceIndex)
 void BrushNode::updateFaceTags(const size_t faceIndex, TagManager& tagManager)
 {
   m_brush.face(faceIndex).updateTags(tagManager);
+  updateFaceTagMasks();
 }
 
 void BrushNode::setFaceMaterial(const size_t faceIndex, Material* material)
@@ -261,6 +265,17 @@ void BrushNode::updateSelectedFaceCount()
   }
 }
 
+void BrushNode::updateFaceTagMasks()
+{
+  m_sharedFaceTags = TagType::AnyType; // set all bits to 1
+  m_combinedFaceTags = TagType::NoType;
+  for (const auto& face : m_brush.faces())
+  {
+    m_sharedFaceTags &= face.tagMask();
+    m_combinedFaceTags |= face.tagMask();
+  }
+}
+
 const std::string& BrushNode::doGetName() const
 {
   static const std::string name("brush");
@@ -361,11 +376,105 @@ void BrushNode::doFindNodesContaining(const vm::vec3d& point, std::vector<Node*>
   }
 }
 
+namespace
+{
+
+/**
+ * Returns the distance from the origin of the given ray to the given face's plane, and
+ * the cosine of the angle between the ray direction and the face normal.
+ */
+std::tuple<double, double> rayPlaneDistance(const BrushFace& face, const vm::ray3d& ray)
+{
+  const auto& plane = face.boundary();
+  const auto cos = vm::dot(plane.normal, ray.direction);
+  return {-plane.point_distance(ray.origin) / cos, cos};
+}
+
+/**
+ * Returns the distances at which the given ray enters and leaves the given brush, or
+ * nullopt if the ray cannot hit any of the brush's faces.
+ *
+ * Since brushes are convex, the ray enters the brush where it crosses the last plane of a
+ * front facing face, and it leaves the brush where it crosses the first plane of a back
+ * facing face. This only requires two dot products per face, which is much cheaper than
+ * intersecting the ray with the face polygons.
+ *
+ * The face polygons do not lie exactly on the face planes, so the planes are moved
+ * outwards by a small tolerance. Faces that are almost parallel to the ray are ignored,
+ * since they cannot be hit. Both make the returned interval larger, so the test is
+ * conservative.
+ */
+std::optional<std::tuple<double, double>> findEntryAndExitDistances(
+  const Brush& brush, const vm::ray3d& ray)
+{
+  constexpr auto epsilon = vm::constants<double>::almost_zero();
+  constexpr auto tolerance = 0.01;
+
+  auto entryDistance = std::numeric_limits<double>::lowest();
+  auto exitDistance = std::numeric_limits<double>::max();
+  for (const auto& face : brush.faces())
+  {
+    if (const auto [distance, cos] = rayPlaneDistance(face, ray); cos < -epsilon)
+    {
+      entryDistance = std::max(entryDistance, distance + tolerance / cos);
+    }
+    else if (cos > epsilon)
+    {
+      exitDistance = std::min(exitDistance, distance + tolerance / cos);
+    }
+  }
+
+  // If the ray leaves the brush behind its origin, then it cannot hit any face.
+  return entryDistance <= exitDistance && exitDistance >= -epsilon
+           ? std::optional{std::tuple{entryDistance, exitDistance}}
+           : std::nullopt;
+}
+
+/**
+ * Indicates whether the given ray may hit the given face if it enters and leaves the
+ * brush at the given distances. Only front facing faces whose plane the ray crosses
+ * between these distances can be hit.
+ */
+bool mayHitFace(
+  const BrushFace& face,
+  const vm::ray3d& ray,
+  const double entryDistance,
+  const double exitDistance)
+{
+  constexpr auto epsilon = vm::constants<double>::almost_zero();
+
+  const auto [distance, cos] = rayPlaneDistance(face, ray);
+  return cos < -epsilon && distance >= entryDistance && distance <= exitDistance;
+}
+
+} // namespace
+
 std::optional<std::tuple<double, size_t>> BrushNode::findFaceHit(
   const vm::ray3d& ray) const
 {
   if (vm::intersect_ray_bbox(ray, logicalBounds()))
   {
+    const auto entryAndExitDistances = findEntryAndExitDistances(m_brush, ray);
+    if (!entryAndExitDistances)
+    {
+      return std::nullopt;
+    }
+
+    const auto [entryDistance, exitDistance] = *entryAndExitDistances;
+    for (size_t i = 0u; i < m_brush.faceCount(); ++i)
+    {
+      const auto& face = m_brush.face(i);
+      if (mayHitFace(face, ray, entryDistance, exitDistance))
+      {
+        if (const auto distance = face.intersectWithRay(ray))
+        {
+          return std::tuple{*distance, i};
+        }
+      }
+    }
+
+    // None of the candidates was hit, which can only happen if the ray passes very close
+    // to the brush. Test all faces to get the same result as an exhaustive search.
     for (size_t i = 0u; i < m_brush.faceCount(); ++i)
     {
       const auto& face = m_brush.face(i);
@@ -410,6 +519,7 @@ void BrushNode::initializeTags(TagManager& tagManager)
   {
     face.initializeTags(tagManager);
   }
+  updateFaceTagMasks();
 }
 
 void BrushNode::clearTags()
@@ -418,6 +528,7 @@ void BrushNode::clearTags()
   {
     face.clearTags();
   }
+  updateFaceTagMasks();
   Taggable::clearTags();
 }
 
@@ -427,47 +538,23 @@ void BrushNode::updateTags(TagManager& tagManager)
   {
     face.updateTags(tagManager);
   }
+  updateFaceTagMasks();
   Taggable::updateTags(tagManager);
 }
 
 bool BrushNode::allFacesHaveAnyTagInMask(TagType::Type tagMask) const
 {
-  // Possible optimization: Store the shared face tag mask in the brush and updated it
-  // when a face changes.
-
-  TagType::Type sharedFaceTags = TagType::AnyType; // set all bits to 1
-  for (const auto& face : m_brush.faces())
-  {
-    sharedFaceTags &= face.tagMask();
-  }
-  return (sharedFaceTags & tagMask) != 0;
+  return (m_sharedFaceTags & tagMask) != 0;
 }
 
 bool BrushNode::anyFaceHasAnyTag() const
 {
-  for (const auto& face : m_brush.faces())
-  {
-    if (face.hasAnyTag())
-    {
-      return true;
-    }
-  }
-  return false;
+  return m_combinedFaceTags != 0;
 }
 
 bool BrushNode::anyFacesHaveAnyTagInMask(TagType::Type tagMask) const
 {
-  // Possible optimization: Store the shared face tag mask in the brush and updated it
-  // when a face changes.
-
-  for (const auto& face : m_brush.faces())
-  {
-    if (face.hasTag(tagMask))
-    {
-      return true;
-    }
-  }
-  return false;
+  return (m_combinedFaceTags & tagMask) != 0;
 }
 
 void BrushNode::doAcceptTagVisitor(TagVisitor& visitor)
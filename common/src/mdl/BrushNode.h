@@ -62,6 +62,10 @@ private:
   Brush m_brush;               // must be destroyed before the brush renderer cache
   size_t m_selectedFaceCount = 0u;
 
+  // the tags that all faces have and the tags that any face has, respectively
+  TagType::Type m_sharedFaceTags = TagType::NoType;
+  TagType::Type m_combinedFaceTags = TagType::NoType;
+
 public:
   explicit BrushNode(Brush brush);
   ~BrushNode() override;
@@ -87,6 +91,7 @@ public:
 private:
   void clearSelectedFaces();
   void updateSelectedFaceCount();
+  void updateFaceTagMasks();
 
 private: // implement Node interface
   const std::string& doGetName() const override;
@@ -59,8 +59,6 @@ DecalSpecification convertToDecal(const el::Value& value)
 }
 } // namespace
 
-kdl_reflect_impl(DecalSpecification);
-
 DecalDefinition::DecalDefinition()
   : m_expression{el::LiteralExpression{el::Value::Undefined}}
 {
@@ -73,6 +71,7 @@ DecalDefinition::DecalDefinition(const FileLocation& location)
 
 DecalDefinition::DecalDefinition(el::ExpressionNode expression)
   : m_expression{std::move(expression)}
+  , m_propertyKeys{m_expression.variableNames()}
 {
 }
 
@@ -83,6 +82,12 @@ void DecalDefinition::append(const DecalDefinition& other)
   auto cases =
     std::vector<el::ExpressionNode>{std::move(m_expression), other.m_expression};
   m_expression = el::ExpressionNode{el::SwitchExpression{std::move(cases)}, location};
+  m_propertyKeys = m_expression.variableNames();
+}
+
+const std::vector<std::string>& DecalDefinition::propertyKeys() const
+{
+  return m_propertyKeys;
 }
 
 DecalSpecification DecalDefinition::decalSpecification(
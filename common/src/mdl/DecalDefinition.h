@@ -20,10 +20,13 @@
 #pragma once
 
 #include "el/Expression.h"
+#include "mdl/DecalSpecification.h"
 
 #include "kdl/reflection_decl.h"
 
 #include <iosfwd>
+#include <string>
+#include <vector>
 
 namespace tb
 {
@@ -38,17 +41,11 @@ namespace DecalSpecificationKeys
 constexpr auto Material = "texture";
 } // namespace DecalSpecificationKeys
 
-struct DecalSpecification
-{
-  std::string materialName;
-
-  kdl_reflect_decl(DecalSpecification, materialName);
-};
-
 class DecalDefinition
 {
 private:
   el::ExpressionNode m_expression;
+  std::vector<std::string> m_propertyKeys;
 
 public:
   DecalDefinition();
@@ -57,6 +54,12 @@ public:
 
   void append(const DecalDefinition& other);
 
+  /**
+   * Returns the keys of the entity properties that the decal expression refers to,
+   * sorted and without duplicates.
+   */
+  const std::vector<std::string>& propertyKeys() const;
+
   /**
    * Evaluates the decal expresion, using the given variable store to interpolate
    * variables.
@@ -224,7 +224,7 @@ bool EditorContext::visible(const mdl::BrushNode* brushNode) const
 bool EditorContext::visible(
   const mdl::BrushNode* brushNode, const mdl::BrushFace& face) const
 {
-  return visible(brushNode) && !face.hasTag(m_hiddenTags);
+  return !face.hasTag(m_hiddenTags) && visible(brushNode);
 }
 
 bool EditorContext::visible(const mdl::PatchNode* patchNode) const
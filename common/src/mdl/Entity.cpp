@@ -95,6 +95,8 @@ void Entity::setProperties(std::vector<EntityProperty> properties)
   m_cachedOrigin = std::nullopt;
   m_cachedRotation = std::nullopt;
   m_cachedModelTransformation = std::nullopt;
+  m_cachedModelSpecification = std::nullopt;
+  m_cachedDecalSpecification = std::nullopt;
 }
 
 const std::vector<std::string>& Entity::protectedProperties() const
@@ -153,6 +155,8 @@ void Entity::setDefinition(EntityDefinition* definition)
 
   m_cachedRotation = std::nullopt;
   m_cachedModelTransformation = std::nullopt;
+  m_cachedModelSpecification = std::nullopt;
+  m_cachedDecalSpecification = std::nullopt;
 }
 
 const EntityModel* Entity::model() const
@@ -180,19 +184,24 @@ const EntityModelFrame* Entity::modelFrame() const
            : nullptr;
 }
 
-ModelSpecification Entity::modelSpecification() const
+const ModelSpecification& Entity::modelSpecification() const
 {
-  if (
-    const auto* pointDefinition =
-      dynamic_cast<const PointEntityDefinition*>(m_definition.get()))
-  {
-    const auto variableStore = EntityPropertiesVariableStore{*this};
-    return pointDefinition->modelDefinition().modelSpecification(variableStore);
-  }
-  else
+  if (!m_cachedModelSpecification)
   {
-    return ModelSpecification{};
+    if (
+      const auto* pointDefinition =
+        dynamic_cast<const PointEntityDefinition*>(m_definition.get()))
+    {
+      const auto variableStore = EntityPropertiesVariableStore{*this};
+      m_cachedModelSpecification =
+        pointDefinition->modelDefinition().modelSpecification(variableStore);
+    }
+    else
+    {
+      m_cachedModelSpecification = ModelSpecification{};
+    }
   }
+  return *m_cachedModelSpecification;
 }
 
 const vm::mat4x4d& Entity::modelTransformation(
@@ -218,19 +227,24 @@ const vm::mat4x4d& Entity::modelTransformation(
   return *m_cachedModelTransformation;
 }
 
-DecalSpecification Entity::decalSpecification() const
+const DecalSpecification& Entity::decalSpecification() const
 {
-  if (
-    const auto* pointDefinition =
-      dynamic_cast<const PointEntityDefinition*>(m_definition.get()))
+  if (!m_cachedDecalSpecification)
   {
-    const auto variableStore = EntityPropertiesVariableStore{*this};
-    return pointDefinition->decalDefinition().decalSpecification(variableStore);
-  }
-  else
-  {
-    return DecalSpecification{};
+    if (
+      const auto* pointDefinition =
+        dynamic_cast<const PointEntityDefinition*>(m_definition.get()))
+    {
+      const auto variableStore = EntityPropertiesVariableStore{*this};
+      m_cachedDecalSpecification =
+        pointDefinition->decalDefinition().decalSpecification(variableStore);
+    }
+    else
+    {
+      m_cachedDecalSpecification = DecalSpecification{};
+    }
   }
+  return *m_cachedDecalSpecification;
 }
 
 void Entity::unsetEntityDefinitionAndModel()
@@ -244,11 +258,15 @@ void Entity::unsetEntityDefinitionAndModel()
   m_model = nullptr;
   m_cachedRotation = std::nullopt;
   m_cachedModelTransformation = std::nullopt;
+  m_cachedModelSpecification = std::nullopt;
+  m_cachedDecalSpecification = std::nullopt;
 }
 
 void Entity::addOrUpdateProperty(
   std::string key, std::string value, const bool defaultToProtected)
 {
+  invalidateCachedSpecifications(key);
+
   auto it = findEntityProperty(m_properties, key);
   if (it != std::end(m_properties))
   {
@@ -294,6 +312,9 @@ void Entity::renameProperty(const std::string& oldKey, std::string newKey)
       m_properties.erase(newIt);
     }
 
+    invalidateCachedSpecifications(oldKey);
+    invalidateCachedSpecifications(newKey);
+
     oldIt->setKey(std::move(newKey));
 
     m_cachedClassname = std::nullopt;
@@ -314,6 +335,7 @@ void Entity::removeProperty(const std::string& key)
     m_cachedOrigin = std::nullopt;
     m_cachedRotation = std::nullopt;
     m_cachedModelTransformation = std::nullopt;
+    invalidateCachedSpecifications(key);
   }
 }
 
@@ -329,6 +351,8 @@ void Entity::removeNumberedProperty(const std::string& prefix)
     m_cachedOrigin = std::nullopt;
     m_cachedRotation = std::nullopt;
     m_cachedModelTransformation = std::nullopt;
+    m_cachedModelSpecification = std::nullopt;
+    m_cachedDecalSpecification = std::nullopt;
   }
 }
 
@@ -480,4 +504,24 @@ void Entity::transform(const vm::mat4x4d& transformation, const bool updateAngle
   }
 }
 
+void Entity::invalidateCachedSpecifications(const std::string& key)
+{
+  if (
+    const auto* pointDefinition =
+      dynamic_cast<const PointEntityDefinition*>(m_definition.get()))
+  {
+    const auto& modelKeys = pointDefinition->modelDefinition().propertyKeys();
+    if (std::ranges::binary_search(modelKeys, key))
+    {
+      m_cachedModelSpecification = std::nullopt;
+    }
+
+    const auto& decalKeys = pointDefinition->decalDefinition().propertyKeys();
+    if (std::ranges::binary_search(decalKeys, key))
+    {
+      m_cachedDecalSpecification = std::nullopt;
+    }
+  }
+}
+
 } // namespace tb::mdl
@@ -21,7 +21,9 @@
 
 #include "el/EL_Forward.h" // IWYU pragma: keep
 #include "mdl/AssetReference.h"
+#include "mdl/DecalSpecification.h"
 #include "mdl/EntityProperties.h"
+#include "mdl/ModelSpecification.h"
 
 #include "kdl/reflection_decl.h"
 
@@ -35,12 +37,10 @@
 
 namespace tb::mdl
 {
-struct DecalSpecification;
 class Entity;
 class EntityDefinition;
 class EntityModel;
 class EntityModelFrame;
-struct ModelSpecification;
 
 enum class SetDefaultPropertyMode
 {
@@ -107,6 +107,13 @@ private:
   mutable std::optional<vm::mat4x4d> m_cachedRotation;
   mutable std::optional<vm::mat4x4d> m_cachedModelTransformation;
 
+  /**
+   * The model and decal specifications are only invalidated when a property changes that
+   * the corresponding expression refers to, see ModelDefinition::propertyKeys.
+   */
+  mutable std::optional<ModelSpecification> m_cachedModelSpecification;
+  mutable std::optional<DecalSpecification> m_cachedDecalSpecification;
+
 public:
   Entity();
   explicit Entity(std::vector<EntityProperty> properties);
@@ -145,11 +152,11 @@ public: // property management
   void setModel(const EntityModel* model);
 
   const EntityModelFrame* modelFrame() const;
-  ModelSpecification modelSpecification() const;
+  const ModelSpecification& modelSpecification() const;
   const vm::mat4x4d& modelTransformation(
     const std::optional<el::ExpressionNode>& defaultModelScaleExpression) const;
 
-  DecalSpecification decalSpecification() const;
+  const DecalSpecification& decalSpecification() const;
 
   void unsetEntityDefinitionAndModel();
 
@@ -181,6 +188,9 @@ public: // property management
   std::vector<EntityProperty> numberedProperties(const std::string& property) const;
 
   void transform(const vm::mat4x4d& transformation, bool updateAngleProperty);
+
+private:
+  void invalidateCachedSpecifications(const std::string& key);
 };
 
 } // namespace tb::mdl
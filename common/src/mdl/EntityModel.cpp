@@ -80,6 +80,25 @@ std::ostream& operator<<(std::ostream& lhs, const Orientation rhs)
 
 // EntityModelFrame
 
+namespace
+{
+
+auto buildSpacialTree(const std::vector<vm::vec3f>& tris)
+{
+  auto spacialTree = octree<float, size_t>{16.0f};
+  for (size_t i = 0; i < tris.size(); i += 3)
+  {
+    auto bounds = vm::bbox3f::builder{};
+    bounds.add(tris[i + 0]);
+    bounds.add(tris[i + 1]);
+    bounds.add(tris[i + 2]);
+    spacialTree.insert(bounds.bounds(), i / 3u);
+  }
+  return spacialTree;
+}
+
+} // namespace
+
 kdl_reflect_impl(EntityModelFrame);
 
 EntityModelFrame::EntityModelFrame(
@@ -87,7 +106,6 @@ EntityModelFrame::EntityModelFrame(
   : m_index{index}
   , m_name{std::move(name)}
   , m_bounds{bounds}
-  , m_spacialTree{16.0f}
 {
 }
 
@@ -118,9 +136,14 @@ const vm::bbox3f& EntityModelFrame::bounds() const
 
 std::optional<float> EntityModelFrame::intersect(const vm::ray3f& ray) const
 {
+  if (!m_spacialTree)
+  {
+    m_spacialTree = buildSpacialTree(m_tris);
+  }
+
   auto closestDistance = std::optional<float>{};
 
-  const auto candidates = m_spacialTree.find_intersectors(ray);
+  const auto candidates = m_spacialTree->find_intersectors(ray);
   for (const auto triNum : candidates)
   {
     const auto& p1 = m_tris[triNum * 3 + 0];
@@ -133,12 +156,14 @@ std::optional<float> EntityModelFrame::intersect(const vm::ray3f& ray) const
   return closestDistance;
 }
 
-void EntityModelFrame::addToSpacialTree(
+void EntityModelFrame::addTrianglesForHitTesting(
   const std::vector<EntityModelVertex>& vertices,
   const render::PrimType primType,
   const size_t index,
   const size_t count)
 {
+  m_spacialTree = std::nullopt;
+
   switch (primType)
   {
   case render::PrimType::Points:
@@ -151,19 +176,12 @@ void EntityModelFrame::addToSpacialTree(
     m_tris.reserve(m_tris.size() + count);
     for (size_t i = 0; i < count; i += 3)
     {
-      auto bounds = vm::bbox3f::builder{};
       const auto& p1 = render::getVertexComponent<0>(vertices[index + i + 0]);
       const auto& p2 = render::getVertexComponent<0>(vertices[index + i + 1]);
       const auto& p3 = render::getVertexComponent<0>(vertices[index + i + 2]);
-      bounds.add(p1);
-      bounds.add(p2);
-      bounds.add(p3);
-
-      const auto triIndex = m_tris.size() / 3u;
       m_tris.push_back(p1);
       m_tris.push_back(p2);
       m_tris.push_back(p3);
-      m_spacialTree.insert(bounds.bounds(), triIndex);
     }
     break;
   }
@@ -175,18 +193,11 @@ void EntityModelFrame::addToSpacialTree(
     const auto& p1 = render::getVertexComponent<0>(vertices[index]);
     for (size_t i = 1; i < count - 1; ++i)
     {
-      auto bounds = vm::bbox3f::builder{};
       const auto& p2 = render::getVertexComponent<0>(vertices[index + i]);
       const auto& p3 = render::getVertexComponent<0>(vertices[index + i + 1]);
-      bounds.add(p1);
-      bounds.add(p2);
-      bounds.add(p3);
-
-      const auto triIndex = m_tris.size() / 3u;
       m_tris.push_back(p1);
       m_tris.push_back(p2);
       m_tris.push_back(p3);
-      m_spacialTree.insert(bounds.bounds(), triIndex);
     }
     break;
   }
@@ -197,15 +208,9 @@ void EntityModelFrame::addToSpacialTree(
     m_tris.reserve(m_tris.size() + (count - 2) * 3);
     for (size_t i = 0; i < count - 2; ++i)
     {
-      auto bounds = vm::bbox3f::builder{};
       const auto& p1 = render::getVertexComponent<0>(vertices[index + i + 0]);
       const auto& p2 = render::getVertexComponent<0>(vertices[index + i + 1]);
       const auto& p3 = render::getVertexComponent<0>(vertices[index + i + 2]);
-      bounds.add(p1);
-      bounds.add(p2);
-      bounds.add(p3);
-
-      const auto triIndex = m_tris.size() / 3u;
       if (i % 2 == 0)
       {
         m_tris.push_back(p1);
@@ -218,7 +223,6 @@ void EntityModelFrame::addToSpacialTree(
         m_tris.push_back(p3);
         m_tris.push_back(p2);
       }
-      m_spacialTree.insert(bounds.bounds(), triIndex);
     }
     break;
   }
@@ -309,7 +313,7 @@ public:
   {
     m_indices.forEachPrimitive(
       [&](const render::PrimType primType, const size_t index, const size_t count) {
-        frame.addToSpacialTree(m_vertices, primType, index, count);
+        frame.addTrianglesForHitTesting(m_vertices, primType, index, count);
       });
   }
 
@@ -355,7 +359,7 @@ public:
                                  const render::PrimType primType,
                                  const size_t index,
                                  const size_t count) {
-      frame.addToSpacialTree(m_vertices, primType, index, count);
+      frame.addTrianglesForHitTesting(m_vertices, primType, index, count);
     });
   }
 
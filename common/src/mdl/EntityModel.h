@@ -94,11 +94,12 @@ private:
   vm::bbox3f m_bounds;
   size_t m_skinOffset = 0;
 
-  // For hit testing
+  // For hit testing, the spacial tree is built when this frame is first intersected, see
+  // intersect
   std::vector<vm::vec3f> m_tris;
   using TriNum = size_t;
   using SpacialTree = octree<float, TriNum>;
-  SpacialTree m_spacialTree;
+  mutable std::optional<SpacialTree> m_spacialTree;
 
   kdl_reflect_decl(EntityModelFrame, m_index, m_name, m_bounds, m_skinOffset);
 
@@ -144,6 +145,10 @@ public:
   /**
    * Intersects this frame with the given ray and returns the point of intersection.
    *
+   * The spacial tree is built on the first call. Since this modifies the frame in a const
+   * function, this function must not be called concurrently. This holds because picking
+   * only happens on the main thread.
+   *
    * @param ray the ray to intersect
    * @return the distance to the point of intersection or nullopt if the given ray does
    * not intersect this frame
@@ -151,7 +156,9 @@ public:
   std::optional<float> intersect(const vm::ray3f& ray) const;
 
   /**
-   * Adds the given primitives to the spacial tree for this frame.
+   * Adds the triangles of the given primitives to the triangles used for hit testing.
+   * The spacial tree is not built here, but lazily on the next call to intersect, so
+   * loading a model does not pay for it unless the model is picked.
    *
    * @param vertices the vertices
    * @param primType the primitive type
@@ -159,7 +166,7 @@ public:
    * array
    * @param count the number of vertices that make up the primitive(s)
    */
-  void addToSpacialTree(
+  void addTrianglesForHitTesting(
     const std::vector<EntityModelVertex>& vertices,
     render::PrimType primType,
     size_t index,
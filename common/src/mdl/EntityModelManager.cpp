@@ -56,6 +56,7 @@ void EntityModelManager::clear()
   m_rendererMismatches.clear();
 
   m_unpreparedRenderers.clear();
+  m_palette = std::nullopt;
 
   // Remove logging because it might fail when the document is already destroyed.
 }
@@ -202,6 +203,11 @@ Result<EntityModel> EntityModelManager::loadModel(
       return createResourceSync(std::move(resourceLoader));
     };
 
+    if (!m_palette)
+    {
+      m_palette = io::loadPalette(fs, materialConfig);
+    }
+
     const auto loadMaterial = [&](const auto& materialPath) {
       return io::loadMaterial(
                fs, materialConfig, materialPath, createResource, m_shaders, std::nullopt)
@@ -210,7 +216,7 @@ Result<EntityModel> EntityModelManager::loadModel(
     };
 
     return io::loadEntityModelAsync(
-      fs, materialConfig, modelPath, loadMaterial, m_createResource, m_logger);
+      fs, *m_palette, modelPath, loadMaterial, m_createResource, m_logger);
   }
   return Error{"Game is not set"};
 }
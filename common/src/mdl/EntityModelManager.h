@@ -22,11 +22,13 @@
 #include "Result.h"
 #include "mdl/EntityModel.h"
 #include "mdl/ModelSpecification.h"
+#include "mdl/Palette.h"
 
 #include "kdl/path_hash.h"
 
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -61,6 +63,9 @@ private:
   // Cache Quake 3 shaders to use when loading models
   std::vector<Quake3Shader> m_shaders;
 
+  // Cache the palette to use when loading models, loaded when the first model is loaded
+  mutable std::optional<Result<Palette>> m_palette;
+
   mutable std::unordered_map<std::filesystem::path, EntityModel, kdl::path_hash> m_models;
   mutable std::
     unordered_map<ModelSpecification, std::unique_ptr<render::MaterialRenderer>>
@@ -24,6 +24,7 @@
 
 #include "kdl/vector_utils.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -322,37 +323,34 @@ bool EntityNodeBase::hasMissingSources() const
 std::vector<std::string> EntityNodeBase::findMissingLinkTargets() const
 {
   auto result = std::vector<std::string>{};
-  findMissingTargets(EntityPropertyKeys::Target, result);
+  findMissingTargets(EntityPropertyKeys::Target, m_linkTargets, result);
   return result;
 }
 
 std::vector<std::string> EntityNodeBase::findMissingKillTargets() const
 {
   auto result = std::vector<std::string>{};
-  findMissingTargets(EntityPropertyKeys::Killtarget, result);
+  findMissingTargets(EntityPropertyKeys::Killtarget, m_killTargets, result);
   return result;
 }
 
 void EntityNodeBase::findMissingTargets(
-  const std::string& prefix, std::vector<std::string>& result) const
+  const std::string& prefix,
+  const std::vector<EntityNodeBase*>& targets,
+  std::vector<std::string>& result) const
 {
+  // the targets are kept up to date with the index, so there is no need to query it
   for (const auto& property : m_entity.numberedProperties(prefix))
   {
     const auto& targetname = property.value();
-    if (targetname.empty())
+    const auto hasTarget =
+      std::any_of(targets.begin(), targets.end(), [&](const auto* target) {
+        return target->entity().hasProperty(EntityPropertyKeys::Targetname, targetname);
+      });
+    if (targetname.empty() || !hasTarget)
     {
       result.push_back(property.key());
     }
-    else
-    {
-      auto linkTargets = std::vector<EntityNodeBase*>{};
-      findEntityNodesWithProperty(
-        EntityPropertyKeys::Targetname, targetname, linkTargets);
-      if (linkTargets.empty())
-      {
-        result.push_back(property.key());
-      }
-    }
   }
 }
 
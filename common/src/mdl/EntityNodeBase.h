@@ -115,7 +115,9 @@ public: // link management
 
 private: // link management internals
   void findMissingTargets(
-    const std::string& prefix, std::vector<std::string>& result) const;
+    const std::string& prefix,
+    const std::vector<EntityNodeBase*>& targets,
+    std::vector<std::string>& result) const;
 
   void addLinks(const std::string& name, const std::string& value);
   void removeLinks(const std::string& name, const std::string& value);
@@ -22,18 +22,30 @@
 #include "Macros.h"
 #include "mdl/Entity.h"
 #include "mdl/EntityNodeBase.h"
-#include "mdl/EntityProperties.h"
 
-#include "kdl/compact_trie.h"
-#include "kdl/vector_utils.h"
-
-#include <iterator>
-#include <list>
+#include <algorithm>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace tb::mdl
 {
+namespace
+{
+
+bool isNumberedKey(const std::string_view prefix, const std::string_view key)
+{
+  if (!key.starts_with(prefix))
+  {
+    return false;
+  }
+
+  const auto suffix = key.substr(prefix.size());
+  return std::all_of(
+    suffix.begin(), suffix.end(), [](const auto c) { return c >= '0' && c <= '9'; });
+}
+
+} // namespace
 
 EntityNodeIndexQuery EntityNodeIndexQuery::exact(std::string pattern)
 {
@@ -55,26 +67,30 @@ EntityNodeIndexQuery EntityNodeIndexQuery::any()
   return EntityNodeIndexQuery{Type::Any};
 }
 
-std::set<EntityNodeBase*> EntityNodeIndexQuery::execute(
-  const EntityNodeStringIndex& index) const
+EntityNodeIndexQuery::Type EntityNodeIndexQuery::type() const
+{
+  return m_type;
+}
+
+const std::string& EntityNodeIndexQuery::pattern() const
+{
+  return m_pattern;
+}
+
+bool EntityNodeIndexQuery::matches(const std::string_view key) const
 {
-  auto result = std::set<EntityNodeBase*>{};
   switch (m_type)
   {
   case Type::Exact:
-    index.find_matches(m_pattern, std::inserter(result, std::end(result)));
-    break;
+    return key == m_pattern;
   case Type::Prefix:
-    index.find_matches(m_pattern + "*", std::inserter(result, std::end(result)));
-    break;
+    return key.starts_with(m_pattern);
   case Type::Numbered:
-    index.find_matches(m_pattern + "%*", std::inserter(result, std::end(result)));
-    break;
+    return isNumberedKey(m_pattern, key);
   case Type::Any:
-    break;
+    return true;
     switchDefault();
   }
-  return result;
 }
 
 bool EntityNodeIndexQuery::execute(
@@ -94,36 +110,54 @@ bool EntityNodeIndexQuery::execute(
   }
 }
 
-std::vector<mdl::EntityProperty> EntityNodeIndexQuery::execute(
-  const EntityNodeBase* node) const
+EntityNodeIndexQuery::EntityNodeIndexQuery(const Type type, std::string pattern)
+  : m_type{type}
+  , m_pattern{std::move(pattern)}
 {
-  const auto& entity = node->entity();
-  switch (m_type)
+}
+
+void EntityNodePostingList::insert(EntityNodeBase* node)
+{
+  if (m_sorted && !m_nodes.empty() && std::less<>{}(node, m_nodes.back()))
   {
-  case Type::Exact:
-    return entity.propertiesWithKey(m_pattern);
-  case Type::Prefix:
-    return entity.propertiesWithPrefix(m_pattern);
-  case Type::Numbered:
-    return entity.numberedProperties(m_pattern);
-  case Type::Any:
-    return entity.properties();
-    switchDefault();
+    m_sorted = false;
   }
+  m_nodes.push_back(node);
 }
 
-EntityNodeIndexQuery::EntityNodeIndexQuery(const Type type, std::string pattern)
-  : m_type{type}
-  , m_pattern{std::move(pattern)}
+void EntityNodePostingList::remove(EntityNodeBase* node)
+{
+  sort();
+
+  const auto it = std::lower_bound(m_nodes.begin(), m_nodes.end(), node);
+  if (it != m_nodes.end() && *it == node)
+  {
+    m_nodes.erase(it);
+  }
+}
+
+bool EntityNodePostingList::empty() const
 {
+  return m_nodes.empty();
 }
 
-EntityNodeIndex::EntityNodeIndex()
-  : m_keyIndex{std::make_unique<EntityNodeStringIndex>()}
-  , m_valueIndex{std::make_unique<EntityNodeStringIndex>()}
+std::span<EntityNodeBase* const> EntityNodePostingList::nodes() const
 {
+  sort();
+  return m_nodes;
 }
 
+void EntityNodePostingList::sort() const
+{
+  if (!m_sorted)
+  {
+    std::sort(m_nodes.begin(), m_nodes.end());
+    m_sorted = true;
+  }
+}
+
+EntityNodeIndex::EntityNodeIndex() = default;
+
 EntityNodeIndex::~EntityNodeIndex() = default;
 
 void EntityNodeIndex::addEntityNode(EntityNodeBase* node)
@@ -145,56 +179,131 @@ void EntityNodeIndex::removeEntityNode(EntityNodeBase* node)
 void EntityNodeIndex::addProperty(
   EntityNodeBase* node, const std::string& key, const std::string& value)
 {
-  m_keyIndex->insert(key, node);
-  m_valueIndex->insert(value, node);
+  auto valueIt = m_valueIndex.find(value);
+  if (valueIt == m_valueIndex.end())
+  {
+    valueIt = m_valueIndex.emplace(value, EntityNodePostingList{}).first;
+  }
+  valueIt->second.insert(node);
+
+  auto keyIt = m_keyIndex.find(key);
+  if (keyIt == m_keyIndex.end())
+  {
+    keyIt = m_keyIndex.emplace(key, KeyEntry{}).first;
+  }
+  keyIt->second.nodes.insert(node);
+  ++keyIt->second.values[valueIt->first];
 }
 
 void EntityNodeIndex::removeProperty(
   EntityNodeBase* node, const std::string& key, const std::string& value)
 {
-  m_keyIndex->remove(key, node);
-  m_valueIndex->remove(value, node);
+  if (const auto keyIt = m_keyIndex.find(key); keyIt != m_keyIndex.end())
+  {
+    auto& keyEntry = keyIt->second;
+    keyEntry.nodes.remove(node);
+
+    if (const auto it = keyEntry.values.find(value); it != keyEntry.values.end())
+    {
+      if (--it->second == 0)
+      {
+        keyEntry.values.erase(it);
+      }
+    }
+
+    if (keyEntry.nodes.empty())
+    {
+      m_keyIndex.erase(keyIt);
+    }
+  }
+
+  // the value must be removed last because the key entries refer to its string
+  if (const auto valueIt = m_valueIndex.find(value); valueIt != m_valueIndex.end())
+  {
+    valueIt->second.remove(node);
+    if (valueIt->second.empty())
+    {
+      m_valueIndex.erase(valueIt);
+    }
+  }
+}
+
+template <typename F>
+void EntityNodeIndex::visitKeys(const EntityNodeIndexQuery& keyQuery, const F& f) const
+{
+  if (keyQuery.type() == EntityNodeIndexQuery::Type::Exact)
+  {
+    if (const auto it = m_keyIndex.find(keyQuery.pattern()); it != m_keyIndex.end())
+    {
+      f(it->second);
+    }
+    return;
+  }
+
+  // all other queries match a range of keys starting with the pattern
+  const auto& prefix = keyQuery.pattern();
+  for (auto it = m_keyIndex.lower_bound(prefix);
+       it != m_keyIndex.end() && it->first.starts_with(prefix);
+       ++it)
+  {
+    if (keyQuery.matches(it->first))
+    {
+      f(it->second);
+    }
+  }
+}
+
+std::span<EntityNodeBase* const> EntityNodeIndex::findEntityNodesWithValue(
+  const std::string_view value) const
+{
+  const auto it = m_valueIndex.find(value);
+  return it != m_valueIndex.end() ? it->second.nodes()
+                                  : std::span<EntityNodeBase* const>{};
 }
 
 std::vector<EntityNodeBase*> EntityNodeIndex::findEntityNodes(
   const EntityNodeIndexQuery& keyQuery, const std::string& value) const
 {
   // first, find Nodes which have `value` as the value for any key
+  const auto nodes = findEntityNodesWithValue(value);
+
+  // the nodes are sorted, so duplicates are adjacent
   auto result = std::vector<EntityNodeBase*>{};
-  m_valueIndex->find_matches(value, std::back_inserter(result));
-  if (result.empty())
+  const EntityNodeBase* previous = nullptr;
+  for (auto* node : nodes)
   {
-    return {};
+    if (node != previous && keyQuery.execute(node, value))
+    {
+      result.push_back(node);
+    }
+    previous = node;
   }
-
-  result = kdl::vec_sort_and_remove_duplicates(std::move(result));
-  std::erase_if(result, [&](const auto* node) { return !keyQuery.execute(node, value); });
   return result;
 }
 
 std::vector<std::string> EntityNodeIndex::allKeys() const
 {
   auto result = std::vector<std::string>{};
-  m_keyIndex->get_keys(std::back_inserter(result));
+  result.reserve(m_keyIndex.size());
+  for (const auto& [key, keyEntry] : m_keyIndex)
+  {
+    result.push_back(key);
+  }
   return result;
 }
 
 std::vector<std::string> EntityNodeIndex::allValuesForKeys(
   const EntityNodeIndexQuery& keyQuery) const
 {
-  auto result = std::vector<std::string>{};
-
-  const auto nameResult = keyQuery.execute(*m_keyIndex);
-  for (const auto node : nameResult)
-  {
-    const auto matchingProperties = keyQuery.execute(node);
-    for (const auto& property : matchingProperties)
+  // the views point into m_valueIndex, so collecting them does not copy any strings
+  auto values = std::unordered_set<std::string_view>{};
+  visitKeys(keyQuery, [&](const auto& keyEntry) {
+    for (const auto& [value, count] : keyEntry.values)
     {
-      result.push_back(property.value());
+      values.insert(value);
     }
-  }
-
-  return result;
+  });
+  return {values.begin(), values.end()};
 }
 
 } // namespace tb::mdl
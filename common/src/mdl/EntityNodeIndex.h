@@ -19,19 +19,18 @@
 
 #pragma once
 
-#include "kdl/compact_trie_forward.h"
-
-#include <memory>
-#include <set>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace tb::mdl
 {
 class EntityNodeBase;
-class EntityProperty;
-
-using EntityNodeStringIndex = kdl::compact_trie<EntityNodeBase*>;
 
 class EntityNodeIndexQuery
 {
@@ -54,19 +53,77 @@ public:
   static EntityNodeIndexQuery numbered(std::string pattern);
   static EntityNodeIndexQuery any();
 
-  std::set<EntityNodeBase*> execute(const EntityNodeStringIndex& index) const;
+  Type type() const;
+  const std::string& pattern() const;
+
+  bool matches(std::string_view key) const;
   bool execute(const EntityNodeBase* node, const std::string& value) const;
-  std::vector<mdl::EntityProperty> execute(const EntityNodeBase* node) const;
 
 private:
   explicit EntityNodeIndexQuery(Type type, std::string pattern = "");
 };
 
+/**
+ * A sorted list of the entity nodes that refer to a key or value. A node is contained
+ * once for every property that refers to the key or value, so it can be removed once per
+ * property again.
+ *
+ * Insertions are appended and the list is only sorted again when it is queried or when a
+ * node is removed. This keeps adding many entities, e.g. when loading a map, linear.
+ */
+class EntityNodePostingList
+{
+private:
+  mutable std::vector<EntityNodeBase*> m_nodes;
+  mutable bool m_sorted = true;
+
+public:
+  void insert(EntityNodeBase* node);
+  void remove(EntityNodeBase* node);
+
+  bool empty() const;
+
+  /**
+   * Returns the nodes in this list in ascending order. A node may be contained more
+   * than once. The returned span is invalidated by the next modification of this list.
+   */
+  std::span<EntityNodeBase* const> nodes() const;
+
+private:
+  void sort() const;
+};
+
 class EntityNodeIndex
 {
 private:
-  std::unique_ptr<EntityNodeStringIndex> m_keyIndex;
-  std::unique_ptr<EntityNodeStringIndex> m_valueIndex;
+  struct StringHash
+  {
+    using is_transparent = void;
+
+    std::size_t operator()(const std::string_view str) const
+    {
+      return std::hash<std::string_view>{}(str);
+    }
+  };
+
+  using ValueIndex = std::unordered_map<
+    std::string,
+    EntityNodePostingList,
+    StringHash,
+    std::equal_to<>>;
+
+  struct KeyEntry
+  {
+    EntityNodePostingList nodes;
+    // the values of all properties with this key, pointing into m_valueIndex, and the
+    // number of properties having that value
+    std::unordered_map<std::string_view, std::size_t> values;
+  };
+
+  using KeyIndex = std::map<std::string, KeyEntry, std::less<>>;
+
+  KeyIndex m_keyIndex;
+  ValueIndex m_valueIndex;
 
 public:
   EntityNodeIndex();
@@ -80,10 +137,21 @@ public:
   void removeProperty(
     EntityNodeBase* node, const std::string& key, const std::string& value);
 
+  /**
+   * Returns the nodes having a property with the given value for any key. The nodes are
+   * sorted and may contain duplicates. The returned span is invalidated by the next
+   * modification of this index.
+   */
+  std::span<EntityNodeBase* const> findEntityNodesWithValue(std::string_view value) const;
+
   std::vector<EntityNodeBase*> findEntityNodes(
     const EntityNodeIndexQuery& keyQuery, const std::string& value) const;
   std::vector<std::string> allKeys() const;
   std::vector<std::string> allValuesForKeys(const EntityNodeIndexQuery& keyQuery) const;
+
+private:
+  template <typename F>
+  void visitKeys(const EntityNodeIndexQuery& keyQuery, const F& f) const;
 };
 
 } // namespace tb::mdl
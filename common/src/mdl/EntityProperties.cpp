@@ -22,7 +22,12 @@
 #include "kdl/reflection_impl.h"
 #include "kdl/string_compare.h"
 
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace tb::mdl
@@ -86,10 +91,80 @@ bool isNumberedProperty(std::string_view prefix, std::string_view key)
   return kdl::cs::str_matches_glob(key, pattern);
 }
 
+namespace
+{
+
+struct StringHash
+{
+  using is_transparent = void;
+
+  std::size_t operator()(const std::string_view str) const
+  {
+    return std::hash<std::string_view>{}(str);
+  }
+};
+
+/**
+ * Returns the pooled copy of the given string. Pooled strings are never released, their
+ * number is bounded by the number of distinct property keys ever used.
+ *
+ * Entities are created concurrently when reading a map, so the pool is guarded by a
+ * shared mutex. Most keys are already pooled, so usually only a shared lock is taken.
+ */
+const std::string* internPropertyKey(const std::string_view str)
+{
+  static auto pool = std::unordered_set<std::string, StringHash, std::equal_to<>>{};
+  static auto mutex = std::shared_mutex{};
+
+  {
+    const auto lock = std::shared_lock{mutex};
+    if (const auto it = pool.find(str); it != pool.end())
+    {
+      return &*it;
+    }
+  }
+
+  const auto lock = std::unique_lock{mutex};
+  return &*pool.emplace(str).first;
+}
+
+} // namespace
+
+EntityPropertyKey::EntityPropertyKey()
+  : EntityPropertyKey{std::string_view{}}
+{
+}
+
+EntityPropertyKey::EntityPropertyKey(const std::string_view str)
+  : m_str{internPropertyKey(str)}
+{
+}
+
+const std::string& EntityPropertyKey::str() const
+{
+  return *m_str;
+}
+
+bool operator==(const EntityPropertyKey& lhs, const EntityPropertyKey& rhs)
+{
+  return lhs.m_str == rhs.m_str;
+}
+
+std::strong_ordering operator<=>(
+  const EntityPropertyKey& lhs, const EntityPropertyKey& rhs)
+{
+  return lhs.m_str == rhs.m_str ? std::strong_ordering::equal : *lhs.m_str <=> *rhs.m_str;
+}
+
+std::ostream& operator<<(std::ostream& lhs, const EntityPropertyKey& rhs)
+{
+  return lhs << rhs.str();
+}
+
 EntityProperty::EntityProperty() = default;
 
-EntityProperty::EntityProperty(std::string key, std::string value)
-  : m_key{std::move(key)}
+EntityProperty::EntityProperty(const std::string_view key, std::string value)
+  : m_key{key}
   , m_value{std::move(value)}
 {
 }
@@ -98,7 +173,7 @@ kdl_reflect_impl(EntityProperty);
 
 const std::string& EntityProperty::key() const
 {
-  return m_key;
+  return m_key.str();
 }
 
 const std::string& EntityProperty::value() const
@@ -108,7 +183,9 @@ const std::string& EntityProperty::value() const
 
 bool EntityProperty::hasKey(std::string_view key) const
 {
-  return kdl::cs::str_is_equal(m_key, key);
+  // keys taken from other properties refer to the same pooled string
+  return key.data() == m_key.str().data() ? key.size() == m_key.str().size()
+                                          : kdl::cs::str_is_equal(m_key.str(), key);
 }
 
 bool EntityProperty::hasValue(const std::string_view value) const
@@ -123,7 +200,7 @@ bool EntityProperty::hasKeyAndValue(std::string_view key, std::string_view value
 
 bool EntityProperty::hasPrefix(const std::string_view prefix) const
 {
-  return kdl::cs::str_is_prefix(m_key, prefix);
+  return kdl::cs::str_is_prefix(m_key.str(), prefix);
 }
 
 bool EntityProperty::hasPrefixAndValue(
@@ -134,7 +211,7 @@ bool EntityProperty::hasPrefixAndValue(
 
 bool EntityProperty::hasNumberedPrefix(const std::string_view prefix) const
 {
-  return isNumberedProperty(prefix, m_key);
+  return isNumberedProperty(prefix, m_key.str());
 }
 
 bool EntityProperty::hasNumberedPrefixAndValue(
@@ -143,9 +220,9 @@ bool EntityProperty::hasNumberedPrefixAndValue(
   return hasNumberedPrefix(prefix) && hasValue(value);
 }
 
-void EntityProperty::setKey(std::string key)
+void EntityProperty::setKey(const std::string_view key)
 {
-  m_key = std::move(key);
+  m_key = EntityPropertyKey{key};
 }
 
 void EntityProperty::setValue(std::string value)
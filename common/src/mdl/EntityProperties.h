@@ -23,8 +23,11 @@
 
 #include "kdl/reflection_decl.h"
 
+#include <compare>
+#include <iosfwd>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace tb::mdl
@@ -94,15 +97,38 @@ struct EntityPropertyConfig
 
 bool isNumberedProperty(std::string_view prefix, std::string_view key);
 
+/**
+ * An entity property key. The key strings are stored once in a global pool that is
+ * shared by all entities, so that the same keys occurring on thousands of entities
+ * only occupy the memory of a pointer each. Two keys are equal if and only if they refer
+ * to the same pooled string. Keys are ordered by their strings.
+ */
+class EntityPropertyKey
+{
+private:
+  const std::string* m_str;
+
+public:
+  EntityPropertyKey();
+  explicit EntityPropertyKey(std::string_view str);
+
+  const std::string& str() const;
+
+  friend bool operator==(const EntityPropertyKey& lhs, const EntityPropertyKey& rhs);
+  friend std::strong_ordering operator<=>(
+    const EntityPropertyKey& lhs, const EntityPropertyKey& rhs);
+  friend std::ostream& operator<<(std::ostream& lhs, const EntityPropertyKey& rhs);
+};
+
 class EntityProperty
 {
 private:
-  std::string m_key;
+  EntityPropertyKey m_key;
   std::string m_value;
 
 public:
   EntityProperty();
-  EntityProperty(std::string key, std::string value);
+  EntityProperty(std::string_view key, std::string value);
 
   kdl_reflect_decl(EntityProperty, m_key, m_value);
 
@@ -117,7 +143,7 @@ public:
   bool hasNumberedPrefix(std::string_view prefix) const;
   bool hasNumberedPrefixAndValue(std::string_view prefix, std::string_view value) const;
 
-  void setKey(std::string key);
+  void setKey(std::string_view key);
   void setValue(std::string value);
 };
 
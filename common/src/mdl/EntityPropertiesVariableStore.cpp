@@ -27,6 +27,14 @@
 
 namespace tb::mdl
 {
+namespace
+{
+
+// Values are immutable and share their contents, so missing properties can all refer to
+// the same empty string instead of allocating a new one for every lookup.
+const auto EmptyStringValue = el::Value{""};
+
+} // namespace
 
 EntityPropertiesVariableStore::EntityPropertiesVariableStore(const Entity& entity)
   : m_entity{entity}
@@ -46,7 +54,7 @@ size_t EntityPropertiesVariableStore::size() const
 el::Value EntityPropertiesVariableStore::value(const std::string& name) const
 {
   const auto* value = m_entity.property(name);
-  return value ? el::Value{*value} : el::Value{""};
+  return value ? el::Value{*value} : EmptyStringValue;
 }
 
 std::vector<std::string> EntityPropertiesVariableStore::names() const
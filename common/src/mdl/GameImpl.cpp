@@ -26,6 +26,7 @@
 #include "io/DiskFileSystem.h"
 #include "io/DiskIO.h"
 #include "io/EntParser.h"
+#include "io/EntityDefinitionClassInfoCache.h"
 #include "io/ExportOptions.h"
 #include "io/FgdParser.h"
 #include "io/GameConfigParser.h"
@@ -34,6 +35,7 @@
 #include "io/NodeWriter.h"
 #include "io/ObjSerializer.h"
 #include "io/PathInfo.h"
+#include "io/RecordingParserStatus.h"
 #include "io/SimpleParserStatus.h"
 #include "io/SystemPaths.h"
 #include "io/TraversalMode.h"
@@ -61,6 +63,47 @@
 
 namespace tb::mdl
 {
+namespace
+{
+
+io::EntityDefinitionClassInfoCache& entityDefinitionClassInfoCache()
+{
+  // shared by all games so that reopening a map does not parse its definitions again
+  static auto cache = io::EntityDefinitionClassInfoCache{};
+  return cache;
+}
+
+/**
+ * Parses the class infos from the given file unless they are cached. The given function
+ * is called with the file contents, the status to log to and a vector to which it must
+ * add all paths of included files. The messages logged while parsing are cached with the
+ * class infos and are logged again on a cache hit.
+ */
+template <typename F>
+Result<std::vector<io::EntityDefinitionClassInfo>> loadClassInfos(
+  io::ParserStatus& status, const std::filesystem::path& path, const F& parseClassInfos)
+{
+  return io::Disk::openFile(path) | kdl::transform([&](auto file) {
+           auto reader = file->reader().buffer();
+           const auto contents = reader.stringView();
+
+           auto& cache = entityDefinitionClassInfoCache();
+           if (auto classInfos = cache.find(status, path, contents))
+           {
+             return std::move(*classInfos);
+           }
+
+           auto recordingStatus = io::RecordingParserStatus{status};
+           auto includedPaths = std::vector<std::filesystem::path>{};
+           auto classInfos = parseClassInfos(contents, recordingStatus, includedPaths);
+           cache.insert(
+             path, contents, includedPaths, classInfos, recordingStatus.messages());
+           return classInfos;
+         });
+}
+
+} // namespace
+
 GameImpl::GameImpl(GameConfig& config, std::filesystem::path gamePath, Logger& logger)
   : m_config{config}
   , m_gamePath{std::move(gamePath)}
@@ -73,32 +116,46 @@ Result<std::vector<std::unique_ptr<EntityDefinition>>> GameImpl::loadEntityDefin
 {
   const auto extension = path.extension().string();
   const auto& defaultColor = m_config.entityConfig.defaultColor;
+  const auto createDefinitions = [&](const auto& classInfos) {
+    return io::createEntityDefinitions(status, classInfos, defaultColor);
+  };
 
   try
   {
     if (kdl::ci::str_is_equal(".fgd", extension))
     {
-      return io::Disk::openFile(path) | kdl::transform([&](auto file) {
-               auto reader = file->reader().buffer();
-               auto parser = io::FgdParser{reader.stringView(), defaultColor, path};
-               return parser.parseDefinitions(status);
-             });
+      return loadClassInfos(
+               status,
+               path,
+               [&](const auto contents, auto& parserStatus, auto& includedPaths) {
+                 auto parser = io::FgdParser{contents, defaultColor, path};
+                 auto classInfos = parser.parseClassInfos(parserStatus);
+                 includedPaths = parser.includedPaths();
+                 return classInfos;
+               })
+             | kdl::transform(createDefinitions);
     }
     if (kdl::ci::str_is_equal(".def", extension))
     {
-      return io::Disk::openFile(path) | kdl::transform([&](auto file) {
-               auto reader = file->reader().buffer();
-               auto parser = io::DefParser{reader.stringView(), defaultColor};
-               return parser.parseDefinitions(status);
-             });
+      return loadClassInfos(
+               status,
+               path,
+               [&](const auto contents, auto& parserStatus, auto&) {
+                 auto parser = io::DefParser{contents, defaultColor};
+                 return parser.parseClassInfos(parserStatus);
+               })
+             | kdl::transform(createDefinitions);
     }
     if (kdl::ci::str_is_equal(".ent", extension))
     {
-      return io::Disk::openFile(path) | kdl::transform([&](auto file) {
-               auto reader = file->reader().buffer();
-               auto parser = io::EntParser{reader.stringView(), defaultColor};
-               return parser.parseDefinitions(status);
-             });
+      return loadClassInfos(
+               status,
+               path,
+               [&](const auto contents, auto& parserStatus, auto&) {
+                 auto parser = io::EntParser{contents, defaultColor};
+                 return parser.parseClassInfos(parserStatus);
+               })
+             | kdl::transform(createDefinitions);
     }
 
     return Error{"Unknown entity definition format: '" + path.string() + "'"};
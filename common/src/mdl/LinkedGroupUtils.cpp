@@ -32,6 +32,7 @@
 #include "kdl/result_fold.h"
 #include "kdl/zip_iterator.h"
 
+#include <numeric>
 #include <string_view>
 #include <unordered_map>
 
@@ -262,77 +263,110 @@ Result<std::unique_ptr<Node>> cloneAndTransformRecursive(
 }
 
 /**
- * Given a node, clones its children recursively and applies the given transform.
- *
- * Returns a vector of the cloned direct children of `node`.
+ * Returns a copy of the contents of the given node with the given transformation applied.
  */
-Result<std::vector<std::unique_ptr<Node>>> cloneAndTransformChildren(
+Result<NodeContents> transformNodeContents(
   const Node& node, const vm::bbox3d& worldBounds, const vm::mat4x4d& transformation)
 {
-  auto nodesToClone = collectDescendants(std::vector{&node});
-
-  using TransformResult = Result<std::pair<const Node*, NodeContents>>;
-
-  // In parallel, produce pairs { node pointer, transformed contents } from the nodes in
-  // `nodesToClone`
-  auto transformResults =
-    kdl::vec_parallel_transform(nodesToClone, [&](const Node* nodeToTransform) {
-      return nodeToTransform->accept(kdl::overload(
-        [](const WorldNode*) -> TransformResult {
-          ensure(false, "Linked group structure is valid");
-        },
-        [](const LayerNode*) -> TransformResult {
-          ensure(false, "Linked group structure is valid");
-        },
-        [&](const GroupNode* groupNode) -> TransformResult {
-          auto group = groupNode->group();
-          group.transform(transformation);
-          return std::make_pair(nodeToTransform, NodeContents{std::move(group)});
-        },
-        [&](const EntityNode* entityNode) -> TransformResult {
-          const auto updateAngleProperty =
-            entityNode->entityPropertyConfig().updateAnglePropertyAfterTransform;
-          auto entity = entityNode->entity();
-          entity.transform(transformation, updateAngleProperty);
-          return std::make_pair(nodeToTransform, NodeContents{std::move(entity)});
-        },
-        [&](const BrushNode* brushNode) -> TransformResult {
-          auto brush = brushNode->brush();
-          return brush.transform(worldBounds, transformation, true)
-                 | kdl::and_then([&]() -> TransformResult {
-                     return std::make_pair(
-                       nodeToTransform, NodeContents{std::move(brush)});
-                   });
-        },
-        [&](const PatchNode* patchNode) -> TransformResult {
-          auto patch = patchNode->patch();
-          patch.transform(transformation);
-          return std::make_pair(nodeToTransform, NodeContents{std::move(patch)});
-        }));
+  return node.accept(kdl::overload(
+    [](const WorldNode*) -> Result<NodeContents> {
+      ensure(false, "Linked group structure is valid");
+    },
+    [](const LayerNode*) -> Result<NodeContents> {
+      ensure(false, "Linked group structure is valid");
+    },
+    [&](const GroupNode* groupNode) -> Result<NodeContents> {
+      auto group = groupNode->group();
+      group.transform(transformation);
+      return NodeContents{std::move(group)};
+    },
+    [&](const EntityNode* entityNode) -> Result<NodeContents> {
+      const auto updateAngleProperty =
+        entityNode->entityPropertyConfig().updateAnglePropertyAfterTransform;
+      auto entity = entityNode->entity();
+      entity.transform(transformation, updateAngleProperty);
+      return NodeContents{std::move(entity)};
+    },
+    [&](const BrushNode* brushNode) -> Result<NodeContents> {
+      auto brush = brushNode->brush();
+      return brush.transform(worldBounds, transformation, true)
+             | kdl::and_then(
+               [&]() -> Result<NodeContents> { return NodeContents{std::move(brush)}; });
+    },
+    [&](const PatchNode* patchNode) -> Result<NodeContents> {
+      auto patch = patchNode->patch();
+      patch.transform(transformation);
+      return NodeContents{std::move(patch)};
+    }));
+}
+
+/**
+ * Given a node, clones its children recursively once for each of the given
+ * transformations and applies the transformation to the clones.
+ *
+ * The contents of all clones are transformed in a single parallel pass, and the cloned
+ * trees are then assembled in parallel.
+ *
+ * Returns, for each transformation, a vector of the cloned direct children of `node`.
+ */
+Result<std::vector<std::vector<std::unique_ptr<Node>>>> cloneAndTransformChildren(
+  const Node& node,
+  const vm::bbox3d& worldBounds,
+  const std::vector<vm::mat4x4d>& transformations)
+{
+  const auto nodesToClone = collectDescendants(std::vector{&node});
+  const auto nodeCount = nodesToClone.size();
+
+  // In parallel, transform the contents of every node in `nodesToClone` by every
+  // transformation. The contents of node n for transformation t are stored at index
+  // t * nodeCount + n.
+  auto indices = std::vector<size_t>(transformations.size() * nodeCount);
+  std::iota(indices.begin(), indices.end(), size_t(0));
+
+  auto transformResults = kdl::vec_parallel_transform(
+    std::move(indices), [&](const size_t index) {
+      return transformNodeContents(
+        *nodesToClone[index % nodeCount],
+        worldBounds,
+        transformations[index / nodeCount]);
     });
 
+  using CloneResult = Result<std::vector<std::unique_ptr<Node>>>;
+
   return std::move(transformResults) | kdl::fold
-         | kdl::or_else(
-           [](const auto&) -> Result<std::vector<std::pair<const Node*, NodeContents>>> {
+         | kdl::or_else([](const auto&) -> Result<std::vector<NodeContents>> {
              return Error{"Failed to transform a linked node"};
            })
          | kdl::and_then(
-           [&](auto origNodeAndTransformedContents)
-             -> Result<std::vector<std::unique_ptr<Node>>> {
-             // Move into map for easier lookup
-             auto resultsMap = std::unordered_map<const Node*, NodeContents>{
-               origNodeAndTransformedContents.begin(),
-               origNodeAndTransformedContents.end()};
-             origNodeAndTransformedContents.clear();
-
-             // Do a recursive traversal of the input node tree again,
-             // creating a matching tree structure, and move in the contents
-             // we've transformed above.
-             return kdl::vec_transform(
-                      node.children(),
-                      [&](const auto* childNode) {
-                        return cloneAndTransformRecursive(
-                          childNode, resultsMap, worldBounds);
+           [&](auto transformedContents)
+             -> Result<std::vector<std::vector<std::unique_ptr<Node>>>> {
+             auto transformationIndices = std::vector<size_t>(transformations.size());
+             std::iota(
+               transformationIndices.begin(), transformationIndices.end(), size_t(0));
+
+             // Do a recursive traversal of the input node tree again for each
+             // transformation, creating a matching tree structure, and move in the
+             // contents we've transformed above.
+             return kdl::vec_parallel_transform(
+                      std::move(transformationIndices),
+                      [&](const size_t transformationIndex) -> CloneResult {
+                        const auto offset = transformationIndex * nodeCount;
+
+                        auto resultsMap = std::unordered_map<const Node*, NodeContents>{};
+                        resultsMap.reserve(nodeCount);
+                        for (size_t i = 0; i < nodeCount; ++i)
+                        {
+                          resultsMap.emplace(
+                            nodesToClone[i], std::move(transformedContents[offset + i]));
+                        }
+
+                        return kdl::vec_transform(
+                                 node.children(),
+                                 [&](const auto* childNode) {
+                                   return cloneAndTransformRecursive(
+                                     childNode, resultsMap, worldBounds);
+                                 })
+                               | kdl::fold;
                       })
                     | kdl::fold;
            });
@@ -477,23 +511,135 @@ Result<UpdateLinkedGroupsResult> updateLinkedGroups(
 
   const auto targetGroupNodesToUpdate =
     kdl::vec_erase(targetGroupNodes, &sourceGroupNode);
-  return kdl::vec_transform(
-           targetGroupNodesToUpdate,
-           [&](auto* targetGroupNode) {
-             const auto transformation =
-               targetGroupNode->group().transformation() * *invertedSourceTransformation;
-             return cloneAndTransformChildren(
-                      sourceGroupNode, worldBounds, transformation)
-                    | kdl::transform([&](auto newChildren) {
-                        const auto linkIdToNodeMap =
-                          makeLinkIdToNodeMap(targetGroupNode->children());
-                        preserveGroupNames(newChildren, linkIdToNodeMap);
-                        preserveEntityProperties(newChildren, linkIdToNodeMap);
-                        return std::pair{
-                          static_cast<Node*>(targetGroupNode), std::move(newChildren)};
-                      });
-           })
-         | kdl::fold;
+  const auto transformations =
+    kdl::vec_transform(targetGroupNodesToUpdate, [&](const auto* targetGroupNode) {
+      return targetGroupNode->group().transformation() * *invertedSourceTransformation;
+    });
+
+  return cloneAndTransformChildren(sourceGroupNode, worldBounds, transformations)
+         | kdl::transform([&](auto newChildrenPerTarget) {
+             // every target group only touches its own clones, so they can be
+             // processed concurrently
+             auto targetIndices = std::vector<size_t>(targetGroupNodesToUpdate.size());
+             std::iota(targetIndices.begin(), targetIndices.end(), size_t(0));
+
+             return kdl::vec_parallel_transform(
+               std::move(targetIndices), [&](const size_t targetIndex) {
+                 auto* targetGroupNode = targetGroupNodesToUpdate[targetIndex];
+                 auto newChildren = std::move(newChildrenPerTarget[targetIndex]);
+
+                 const auto linkIdToNodeMap =
+                   makeLinkIdToNodeMap(targetGroupNode->children());
+                 preserveGroupNames(newChildren, linkIdToNodeMap);
+                 preserveEntityProperties(newChildren, linkIdToNodeMap);
+                 return std::pair{
+                   static_cast<Node*>(targetGroupNode), std::move(newChildren)};
+               });
+           });
+}
+
+namespace
+{
+
+template <typename N, typename GetContents>
+bool diffObjectNode(
+  N& currentNode,
+  const Node& newNode,
+  const GetContents& getContents,
+  LinkedGroupContentChanges& changes)
+{
+  const auto* newObjectNode = dynamic_cast<const N*>(&newNode);
+  if (!newObjectNode || newObjectNode->linkId() != currentNode.linkId())
+  {
+    return false;
+  }
+
+  if (!(getContents(currentNode) == getContents(*newObjectNode)))
+  {
+    changes.emplace_back(&currentNode, NodeContents{getContents(*newObjectNode)});
+  }
+  return true;
+}
+
+bool diffNodes(
+  const std::vector<Node*>& currentNodes,
+  const std::vector<const Node*>& newNodes,
+  LinkedGroupContentChanges& changes);
+
+bool diffNode(Node& currentNode, const Node& newNode, LinkedGroupContentChanges& changes)
+{
+  const auto nodesMatch = currentNode.accept(kdl::overload(
+    [](WorldNode*) { return false; },
+    [](LayerNode*) { return false; },
+    [&](GroupNode* groupNode) {
+      return diffObjectNode(
+        *groupNode,
+        newNode,
+        [](const GroupNode& node) -> const Group& { return node.group(); },
+        changes);
+    },
+    [&](EntityNode* entityNode) {
+      return diffObjectNode(
+        *entityNode,
+        newNode,
+        [](const EntityNode& node) -> const Entity& { return node.entity(); },
+        changes);
+    },
+    [&](BrushNode* brushNode) {
+      return diffObjectNode(
+        *brushNode,
+        newNode,
+        [](const BrushNode& node) -> const Brush& { return node.brush(); },
+        changes);
+    },
+    [&](PatchNode* patchNode) {
+      return diffObjectNode(
+        *patchNode,
+        newNode,
+        [](const PatchNode& node) -> const BezierPatch& { return node.patch(); },
+        changes);
+    }));
+
+  return nodesMatch
+         && diffNodes(
+           currentNode.children(),
+           kdl::vec_static_cast<const Node*>(newNode.children()),
+           changes);
+}
+
+bool diffNodes(
+  const std::vector<Node*>& currentNodes,
+  const std::vector<const Node*>& newNodes,
+  LinkedGroupContentChanges& changes)
+{
+  if (currentNodes.size() != newNodes.size())
+  {
+    return false;
+  }
+
+  for (size_t i = 0; i < currentNodes.size(); ++i)
+  {
+    if (!diffNode(*currentNodes[i], *newNodes[i], changes))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+std::optional<LinkedGroupContentChanges> diffLinkedGroupChildren(
+  const std::vector<Node*>& currentChildren,
+  const std::vector<std::unique_ptr<Node>>& newChildren)
+{
+  auto changes = LinkedGroupContentChanges{};
+  const auto newChildPtrs = kdl::vec_transform(
+    newChildren, [](const auto& child) -> const Node* { return child.get(); });
+
+  return diffNodes(currentChildren, newChildPtrs, changes)
+           ? std::optional{std::move(changes)}
+           : std::nullopt;
 }
 
 namespace
@@ -25,6 +25,7 @@
 #include "mdl/EntityNode.h" // IWYU pragma: keep
 #include "mdl/GroupNode.h"
 #include "mdl/LayerNode.h"
+#include "mdl/NodeContents.h"
 #include "mdl/NodeVisitor.h"
 #include "mdl/PatchNode.h" // IWYU pragma: keep
 #include "mdl/WorldNode.h"
@@ -33,6 +34,7 @@
 #include "kdl/vector_utils.h"
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -135,6 +137,22 @@ Result<UpdateLinkedGroupsResult> updateLinkedGroups(
   const std::vector<mdl::GroupNode*>& targetGroupNodes,
   const vm::bbox3d& worldBounds);
 
+using LinkedGroupContentChanges = std::vector<std::pair<Node*, NodeContents>>;
+
+/**
+ * Compares the current children of a linked group node with the new children that were
+ * computed for it by updateLinkedGroups.
+ *
+ * Nodes are matched by their position in the tree and must be of the same type and have
+ * the same link ID. If every node matches, then the new contents of every current node
+ * whose contents differ from those of its counterpart are returned, so that the linked
+ * group can be updated in place. Otherwise, e.g. if nodes were added or removed, nullopt
+ * is returned and the children must be replaced instead.
+ */
+std::optional<LinkedGroupContentChanges> diffLinkedGroupChildren(
+  const std::vector<Node*>& currentChildren,
+  const std::vector<std::unique_ptr<Node>>& newChildren);
+
 std::vector<Error> initializeLinkIds(const std::vector<Node*>& nodes);
 
 /**
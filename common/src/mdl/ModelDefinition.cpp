@@ -48,6 +48,7 @@ ModelDefinition::ModelDefinition(const FileLocation& location)
 
 ModelDefinition::ModelDefinition(el::ExpressionNode expression)
   : m_expression{std::move(expression)}
+  , m_propertyKeys{m_expression.variableNames()}
 {
 }
 
@@ -57,6 +58,12 @@ void ModelDefinition::append(ModelDefinition other)
 
   auto cases = std::vector{std::move(m_expression), std::move(other.m_expression)};
   m_expression = el::ExpressionNode{el::SwitchExpression{std::move(cases)}, location};
+  m_propertyKeys = m_expression.variableNames();
+}
+
+const std::vector<std::string>& ModelDefinition::propertyKeys() const
+{
+  return m_propertyKeys;
 }
 
 static std::filesystem::path path(const el::Value& value)
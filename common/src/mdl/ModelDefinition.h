@@ -27,6 +27,8 @@
 #include "vm/vec.h"
 
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace tb
 {
@@ -48,6 +50,7 @@ class ModelDefinition
 {
 private:
   el::ExpressionNode m_expression;
+  std::vector<std::string> m_propertyKeys;
 
 public:
   ModelDefinition();
@@ -57,6 +60,13 @@ public:
 
   void append(ModelDefinition other);
 
+  /**
+   * Returns the keys of the entity properties that the model expression refers to,
+   * sorted and without duplicates. The model specification of an entity can only change
+   * if one of these properties changes.
+   */
+  const std::vector<std::string>& propertyKeys() const;
+
   /**
    * Evaluates the model expresion, using the given variable store to interpolate
    * variables.
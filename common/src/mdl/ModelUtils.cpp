@@ -25,8 +25,11 @@
 #include "mdl/EditorContext.h"
 #include "mdl/NodeQueries.h"
 
+#include "kdl/parallel.h"
 #include "kdl/vector_utils.h"
 
+#include <algorithm>
+#include <unordered_set>
 #include <vector>
 
 namespace tb::mdl
@@ -161,32 +164,138 @@ std::map<Node*, std::vector<Node*>> parentChildrenMap(const std::vector<Node*>&
   return result;
 }
 
+namespace
+{
+
 /**
- * Recursively collect brushes and entities from the given vector of node trees such that
- * the returned nodes match the given predicate. A matching brush is only returned if it
- * isn't in the given vector brushes. A node matches the given predicate if there is a
- * brush in the given vector of brushes such that the predicate evaluates to true for that
- * pair of node and brush.
+ * Matching candidates are tested in parallel if there are at least this many of them.
+ */
+constexpr auto ParallelMatchThreshold = size_t(1024);
+
+/**
+ * Returns the subset of the given candidates for which there is a brush in the given
+ * vector of brushes such that the given predicate evaluates to true for that pair of node
+ * and brush. The order of the candidates is preserved.
  *
- * The given predicate must be a function that maps a node and a brush to true or false.
+ * The predicate is only evaluated for brushes whose bounds intersect with the candidate's
+ * physical bounds, so it must not match any other pairs of node and brush.
  */
 template <typename P>
-static std::vector<Node*> collectMatchingNodes(
-  const std::vector<Node*>& nodes,
+std::vector<Node*> filterMatchingNodes(
+  const std::vector<Node*>& candidates,
   const std::vector<BrushNode*>& brushes,
   const P& predicate)
+{
+  // Computing the bounds validates any cached bounds before the candidates are tested in
+  // parallel below.
+  const auto candidateBounds = kdl::vec_transform(
+    candidates, [](const auto* node) { return node->physicalBounds(); });
+
+  const auto isMatching = [&](const size_t i) {
+    return std::any_of(brushes.begin(), brushes.end(), [&](const auto* brush) {
+      return brush->physicalBounds().intersects(candidateBounds[i])
+             && predicate(candidates[i], brush);
+    });
+  };
+
+  auto matches = std::vector<char>(candidates.size(), 0);
+  if (candidates.size() < ParallelMatchThreshold)
+  {
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+      matches[i] = isMatching(i);
+    }
+  }
+  else
+  {
+    kdl::parallel_for(candidates.size(), [&](const size_t i) {
+      matches[i] = isMatching(i);
+    });
+  }
+
+  auto result = std::vector<Node*>{};
+  for (size_t i = 0; i < candidates.size(); ++i)
+  {
+    if (matches[i])
+    {
+      result.push_back(candidates[i]);
+    }
+  }
+  return result;
+}
+
+/**
+ * Collects the candidates for matching from the given world's spatial index. A candidate
+ * is either a node whose bounds intersect with the bounds of one of the given brushes or
+ * the outermost closed group containing such a node.
+ */
+std::vector<Node*> collectMatchingCandidates(
+  const WorldNode& world,
+  const std::vector<BrushNode*>& brushes,
+  const std::unordered_set<const Node*>& brushSet)
 {
   auto result = std::vector<Node*>{};
+  auto visited = std::unordered_set<Node*>{};
+
+  const auto addCandidate = [&](Node* node) {
+    if (visited.insert(node).second)
+    {
+      result.push_back(node);
+    }
+  };
 
-  const auto collectIfMatching = [&](auto* node) {
-    for (const auto* brush : brushes)
+  for (const auto* brush : brushes)
+  {
+    for (auto* node : world.nodeTree().find_intersectors(brush->physicalBounds()))
     {
-      if (predicate(node, brush))
+      if (auto* group = findOutermostClosedGroup(node))
+      {
+        addCandidate(group);
+      }
+      else
       {
-        result.push_back(node);
-        return;
+        node->accept(kdl::overload(
+          [](WorldNode*) {},
+          [](LayerNode*) {},
+          [](GroupNode*) {},
+          [&](EntityNode* entity) {
+            // entities with children are matched by their children
+            if (!entity->hasChildren())
+            {
+              addCandidate(entity);
+            }
+          },
+          [&](BrushNode* brushNode) {
+            // if `brushNode` is one of the search query nodes, don't count it as matching
+            if (!brushSet.contains(brushNode))
+            {
+              addCandidate(brushNode);
+            }
+          },
+          [&](PatchNode* patch) { addCandidate(patch); }));
       }
     }
+  }
+
+  return result;
+}
+
+/**
+ * Recursively collects the candidates for matching from the given vector of node trees.
+ * Subtrees whose bounds do not intersect with the given bounds are skipped.
+ */
+std::vector<Node*> collectMatchingCandidates(
+  const std::vector<Node*>& nodes,
+  const vm::bbox3d& bounds,
+  const std::unordered_set<const Node*>& brushSet)
+{
+  auto result = std::vector<Node*>{};
+
+  const auto addCandidate = [&](Node* node) {
+    if (bounds.intersects(node->physicalBounds()))
+    {
+      result.push_back(node);
+    }
   };
 
   for (auto* node : nodes)
@@ -197,39 +306,85 @@ static std::vector<Node*> collectMatchingNodes(
       [&](auto&& thisLambda, GroupNode* group) {
         if (group->opened() || group->hasOpenedDescendant())
         {
-          group->visitChildren(thisLambda);
+          if (bounds.intersects(group->physicalBounds()))
+          {
+            group->visitChildren(thisLambda);
+          }
         }
         else
         {
-          collectIfMatching(group);
+          addCandidate(group);
         }
       },
       [&](auto&& thisLambda, EntityNode* entity) {
         if (entity->hasChildren())
         {
-          entity->visitChildren(thisLambda);
+          if (bounds.intersects(entity->physicalBounds()))
+          {
+            entity->visitChildren(thisLambda);
+          }
         }
         else
         {
-          collectIfMatching(entity);
+          addCandidate(entity);
         }
       },
       [&](BrushNode* brush) {
-        // if `brush` is one of the search query nodes, don't count it as touching
-        if (!kdl::vec_contains(brushes, brush))
+        // if `brush` is one of the search query nodes, don't count it as matching
+        if (!brushSet.contains(brush))
         {
-          collectIfMatching(brush);
+          addCandidate(brush);
         }
       },
-      [&](PatchNode* patch) {
-        // if `patch` is one of the search query nodes, don't count it as touching
-        collectIfMatching(patch);
-      }));
+      [&](PatchNode* patch) { addCandidate(patch); }));
   }
 
   return result;
 }
 
+/**
+ * Recursively collect brushes and entities from the given vector of node trees such that
+ * the returned nodes match the given predicate. A matching brush is only returned if it
+ * isn't in the given vector brushes. A node matches the given predicate if there is a
+ * brush in the given vector of brushes such that the predicate evaluates to true for that
+ * pair of node and brush.
+ *
+ * If the given vector of nodes consists of a single world node, its spatial index is
+ * used to find the candidates. The order of the returned nodes is unspecified in this
+ * case. Otherwise, the returned nodes are in the order in which they are visited.
+ *
+ * The given predicate must be a function that maps a node and a brush to true or false.
+ * It must be safe to call it concurrently.
+ */
+template <typename P>
+std::vector<Node*> collectMatchingNodes(
+  const std::vector<Node*>& nodes,
+  const std::vector<BrushNode*>& brushes,
+  const P& predicate)
+{
+  if (brushes.empty())
+  {
+    return {};
+  }
+
+  const auto brushSet = std::unordered_set<const Node*>{brushes.begin(), brushes.end()};
+
+  auto boundsBuilder = vm::bbox3d::builder{};
+  for (const auto* brush : brushes)
+  {
+    boundsBuilder.add(brush->physicalBounds());
+  }
+  const auto bounds = boundsBuilder.bounds();
+
+  auto* world = nodes.size() == 1u ? dynamic_cast<WorldNode*>(nodes.front()) : nullptr;
+  const auto candidates = world ? collectMatchingCandidates(*world, brushes, brushSet)
+                                : collectMatchingCandidates(nodes, bounds, brushSet);
+
+  return filterMatchingNodes(candidates, brushes, predicate);
+}
+
+} // namespace
+
 std::vector<Node*> collectTouchingNodes(
   const std::vector<Node*>& nodes, const std::vector<BrushNode*>& brushes)
 {
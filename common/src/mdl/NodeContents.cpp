@@ -20,11 +20,66 @@
 #include "NodeContents.h"
 
 #include "mdl/BrushFace.h"
+#include "mdl/BrushNode.h"
+#include "mdl/EntityNode.h"
+#include "mdl/EntityProperties.h"
+#include "mdl/GroupNode.h"
+#include "mdl/LayerNode.h"
+#include "mdl/PatchNode.h"
+#include "mdl/WorldNode.h"
 
 #include "kdl/overload.h"
 
 namespace tb::mdl
 {
+namespace
+{
+
+size_t contentsMemoryUsage(const Layer& layer)
+{
+  return sizeof(Layer) + layer.name().size();
+}
+
+size_t contentsMemoryUsage(const Group& group)
+{
+  return sizeof(Group) + group.name().size();
+}
+
+size_t contentsMemoryUsage(const Entity& entity)
+{
+  auto result = sizeof(Entity);
+  for (const auto& property : entity.properties())
+  {
+    // the keys are stored in a global pool
+    result += sizeof(EntityProperty) + property.value().size();
+  }
+  return result;
+}
+
+size_t contentsMemoryUsage(const Brush& brush)
+{
+  auto result = sizeof(Brush);
+  for (const auto& face : brush.faces())
+  {
+    result += sizeof(BrushFace) + face.attributes().materialName().size();
+  }
+  if (brush.isGeometryShared())
+  {
+    return result;
+  }
+  result += sizeof(BrushGeometry) + brush.vertexCount() * sizeof(BrushVertex)
+            + brush.edgeCount() * (sizeof(BrushEdge) + 2 * sizeof(BrushHalfEdge))
+            + brush.faceCount() * sizeof(BrushFaceGeometry);
+  return result;
+}
+
+size_t contentsMemoryUsage(const BezierPatch& patch)
+{
+  return sizeof(BezierPatch) + patch.materialName().size()
+         + patch.controlPoints().size() * sizeof(BezierPatch::Point);
+}
+
+} // namespace
 
 NodeContents::NodeContents(
   std::variant<Layer, Group, Entity, Brush, BezierPatch> contents)
@@ -55,4 +110,39 @@ std::variant<Layer, Group, Entity, Brush, BezierPatch>& NodeContents::get()
   return m_contents;
 }
 
+size_t NodeContents::memoryUsage() const
+{
+  return std::visit(
+    [](const auto& contents) { return contentsMemoryUsage(contents); }, m_contents);
+}
+
+size_t memoryUsage(const Node& node)
+{
+  auto result = size_t(0);
+  node.accept(kdl::overload(
+    [&](auto&& thisLambda, const WorldNode* world) {
+      result += sizeof(WorldNode) + contentsMemoryUsage(world->entity());
+      world->visitChildren(thisLambda);
+    },
+    [&](auto&& thisLambda, const LayerNode* layer) {
+      result += sizeof(LayerNode) + contentsMemoryUsage(layer->layer());
+      layer->visitChildren(thisLambda);
+    },
+    [&](auto&& thisLambda, const GroupNode* group) {
+      result += sizeof(GroupNode) + contentsMemoryUsage(group->group());
+      group->visitChildren(thisLambda);
+    },
+    [&](auto&& thisLambda, const EntityNode* entity) {
+      result += sizeof(EntityNode) + contentsMemoryUsage(entity->entity());
+      entity->visitChildren(thisLambda);
+    },
+    [&](const BrushNode* brush) {
+      result += sizeof(BrushNode) + contentsMemoryUsage(brush->brush());
+    },
+    [&](const PatchNode* patch) {
+      result += sizeof(PatchNode) + contentsMemoryUsage(patch->patch());
+    }));
+  return result;
+}
+
 } // namespace tb::mdl
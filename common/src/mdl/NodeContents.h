@@ -29,6 +29,7 @@
 
 namespace tb::mdl
 {
+class Node;
 
 class NodeContents
 {
@@ -44,6 +45,19 @@ public:
 
   const std::variant<Layer, Group, Entity, Brush, BezierPatch>& get() const;
   std::variant<Layer, Group, Entity, Brush, BezierPatch>& get();
+
+  /**
+   * Returns an approximation of the number of bytes of memory held by these contents.
+   * Brush geometry is only counted if no other copy of the brush shares it, and entity
+   * property keys are not counted because they are pooled.
+   */
+  size_t memoryUsage() const;
 };
 
+/**
+ * Returns an approximation of the number of bytes of memory held by the given node and
+ * its descendants, estimated like NodeContents::memoryUsage.
+ */
+size_t memoryUsage(const Node& node);
+
 } // namespace tb::mdl
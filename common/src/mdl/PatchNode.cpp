@@ -39,14 +39,13 @@
 #include "vm/intersection.h"
 #include "vm/vec_io.h" // IWYU pragma: keep
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 
 namespace tb::mdl
 {
 
-constexpr static size_t DefaultSubdivisionsPerSurface = 3u;
-
 kdl_reflect_impl(PatchGrid::Point);
 
 const PatchGrid::Point& PatchGrid::point(const size_t row, const size_t col) const
@@ -291,6 +290,51 @@ PatchGrid makePatchGrid(const BezierPatch& patch, const size_t subdivisionsPerSu
     gridPointRowCount, gridPointColumnCount, std::move(points), boundsBuilder.bounds()};
 }
 
+namespace
+{
+
+size_t selectPatchSubdivisions(const double distanceToSizeRatio, const double scale)
+{
+  // Halving the number of subdivisions roughly quadruples the deviation of the grid from
+  // the surface, while the projected deviation decreases linearly with the distance. So
+  // we remove one subdivision whenever the distance quadruples.
+  constexpr auto MinDistanceToSizeRatio = 2.0;
+  constexpr auto DistanceToSizeRatioFactor = 4.0;
+
+  auto subdivisions = PatchNode::DefaultSubdivisionsPerSurface;
+  auto threshold = MinDistanceToSizeRatio * scale;
+  while (subdivisions > 0u && distanceToSizeRatio > threshold)
+  {
+    --subdivisions;
+    threshold *= DistanceToSizeRatioFactor;
+  }
+  return subdivisions;
+}
+
+} // namespace
+
+size_t selectPatchSubdivisions(
+  const vm::bbox3d& bounds,
+  const vm::vec3d& viewPosition,
+  const std::optional<size_t> currentSubdivisions)
+{
+  const auto size = std::max(vm::length(bounds.size()), 1.0);
+  const auto distance = vm::distance(viewPosition, bounds.constrain(viewPosition));
+  const auto ratio = distance / size;
+
+  if (!currentSubdivisions)
+  {
+    return selectPatchSubdivisions(ratio, 1.0);
+  }
+
+  // keep the current subdivisions unless a threshold is exceeded by this fraction
+  constexpr auto Hysteresis = 0.25;
+
+  const auto maxSubdivisions = selectPatchSubdivisions(ratio, 1.0 + Hysteresis);
+  const auto minSubdivisions = selectPatchSubdivisions(ratio, 1.0 - Hysteresis);
+  return std::clamp(*currentSubdivisions, minSubdivisions, maxSubdivisions);
+}
+
 const HitType::Type PatchNode::PatchHitType = HitType::freeType();
 
 PatchNode::PatchNode(BezierPatch patch)
@@ -29,6 +29,9 @@
 #include "vm/bbox.h"
 #include "vm/vec.h"
 
+#include <optional>
+#include <vector>
+
 namespace tb::mdl
 {
 class EntityNodeBase;
@@ -64,13 +67,36 @@ std::vector<vm::vec3d> computeGridNormals(
   size_t pointRowCount,
   size_t pointColumnCount);
 
-// public for testing
+/**
+ * Tessellates the given patch with the given number of subdivisions per surface.
+ */
 PatchGrid makePatchGrid(const BezierPatch& patch, size_t subdivisionsPerSurface);
 
+/**
+ * Selects the number of subdivisions per surface to tessellate a patch with the given
+ * bounds with when it is viewed from the given position. The further away the patch is
+ * in relation to its size, the fewer subdivisions are selected.
+ *
+ * If the number of subdivisions currently used for the patch is given, it is only changed
+ * if the view position is clearly past the corresponding threshold. This prevents the
+ * selection from switching back and forth when the viewer moves near a threshold.
+ *
+ * @param bounds the bounds of the patch
+ * @param viewPosition the position of the viewer
+ * @param currentSubdivisions the number of subdivisions currently used for the patch
+ * @return the number of subdivisions per surface, at most
+ * PatchNode::DefaultSubdivisionsPerSurface
+ */
+size_t selectPatchSubdivisions(
+  const vm::bbox3d& bounds,
+  const vm::vec3d& viewPosition,
+  std::optional<size_t> currentSubdivisions = std::nullopt);
+
 class PatchNode : public Node, public Object
 {
 public:
   static const HitType::Type PatchHitType;
+  static constexpr size_t DefaultSubdivisionsPerSurface = 3u;
 
 private:
   BezierPatch m_patch;
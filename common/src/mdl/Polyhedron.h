@@ -1719,6 +1719,9 @@ private: // Convex hull; adding and removing points
    * Therefore, the result of calling this method is different from the result of
    * repeatedly calling addPoint() for every point in the given vector.
    *
+   * For large point sets, points that lie inside the convex hull of the extreme points of
+   * the set are discarded before the remaining points are added.
+   *
    * @param points the points to add to this polyhedron
    */
   void addPoints(std::vector<vm::vec<T, 3>> points);
@@ -22,6 +22,7 @@
 #include "Macros.h"
 #include "Polyhedron.h"
 
+#include "kdl/parallel.h"
 #include "kdl/vector_utils.h"
 
 #include "vm/bbox.h"
@@ -30,6 +31,8 @@
 #include "vm/segment.h"
 #include "vm/util.h"
 
+#include <algorithm>
+#include <array>
 #include <list>
 #include <unordered_set>
 #include <vector>
@@ -51,6 +54,137 @@ T computePlaneEpsilon(const std::vector<vm::vec<T, 3>>& points)
     vm::get_max_component(size) / T(10) * vm::constants<T>::point_status_epsilon();
   return std::max(computedEpsilon, defaultEpsilon);
 }
+
+/**
+ * Point sets with at least this many points are culled before the hull is built.
+ */
+constexpr auto InteriorPointCullingThreshold = size_t(64);
+
+/**
+ * The points are classified in parallel if there are at least this many of them.
+ */
+constexpr auto ParallelPointClassificationThreshold = size_t(8192);
+
+/**
+ * Returns the points that are extreme in one of the 13 directions given by the
+ * coordinate axes, the face diagonals and the space diagonals of a cube.
+ */
+template <typename T>
+std::vector<vm::vec<T, 3>> findExtremePoints(const std::vector<vm::vec<T, 3>>& points)
+{
+  assert(!points.empty());
+
+  static const auto directions = std::array<vm::vec<T, 3>, 13>{
+    vm::vec<T, 3>{1, 0, 0},
+    vm::vec<T, 3>{0, 1, 0},
+    vm::vec<T, 3>{0, 0, 1},
+    vm::vec<T, 3>{1, 1, 0},
+    vm::vec<T, 3>{1, -1, 0},
+    vm::vec<T, 3>{1, 0, 1},
+    vm::vec<T, 3>{1, 0, -1},
+    vm::vec<T, 3>{0, 1, 1},
+    vm::vec<T, 3>{0, 1, -1},
+    vm::vec<T, 3>{1, 1, 1},
+    vm::vec<T, 3>{1, 1, -1},
+    vm::vec<T, 3>{1, -1, 1},
+    vm::vec<T, 3>{1, -1, -1},
+  };
+
+  auto minIndices = std::array<size_t, 13>{};
+  auto maxIndices = std::array<size_t, 13>{};
+  auto minDots = std::array<T, 13>{};
+  auto maxDots = std::array<T, 13>{};
+  for (size_t d = 0; d < directions.size(); ++d)
+  {
+    minDots[d] = maxDots[d] = vm::dot(points.front(), directions[d]);
+  }
+
+  for (size_t i = 1; i < points.size(); ++i)
+  {
+    for (size_t d = 0; d < directions.size(); ++d)
+    {
+      const auto dot = vm::dot(points[i], directions[d]);
+      if (dot < minDots[d])
+      {
+        minDots[d] = dot;
+        minIndices[d] = i;
+      }
+      else if (dot > maxDots[d])
+      {
+        maxDots[d] = dot;
+        maxIndices[d] = i;
+      }
+    }
+  }
+
+  auto result = std::vector<vm::vec<T, 3>>{};
+  result.reserve(2 * directions.size());
+  for (size_t d = 0; d < directions.size(); ++d)
+  {
+    result.push_back(points[minIndices[d]]);
+    result.push_back(points[maxIndices[d]]);
+  }
+  return kdl::vec_sort_and_remove_duplicates(std::move(result));
+}
+
+/**
+ * Removes the points that lie strictly inside the convex hull of the extreme points of
+ * the given points. Such points can never become vertices of the convex hull of all
+ * points, but adding them one by one requires a horizon search for each of them.
+ *
+ * The order of the remaining points is preserved.
+ *
+ * @tparam P the polyhedron type used to build the hull of the extreme points
+ */
+template <typename P, typename T>
+std::vector<vm::vec<T, 3>> removeInteriorPoints(
+  std::vector<vm::vec<T, 3>> points, const T planeEpsilon)
+{
+  const auto extremeHull = P{findExtremePoints(points)};
+  if (!extremeHull.polyhedron())
+  {
+    return points;
+  }
+
+  auto planes = std::vector<vm::plane<T, 3>>{};
+  planes.reserve(extremeHull.faceCount());
+  for (const auto* face : extremeHull.faces())
+  {
+    planes.push_back(face->plane());
+  }
+
+  const auto isInterior = [&](const vm::vec<T, 3>& point) {
+    return std::all_of(planes.begin(), planes.end(), [&](const auto& plane) {
+      return plane.point_distance(point) < -planeEpsilon;
+    });
+  };
+
+  auto interior = std::vector<char>(points.size(), 0);
+  if (points.size() < ParallelPointClassificationThreshold)
+  {
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+      interior[i] = isInterior(points[i]);
+    }
+  }
+  else
+  {
+    kdl::parallel_for(
+      points.size(), [&](const size_t i) { interior[i] = isInterior(points[i]); });
+  }
+
+  auto result = std::vector<vm::vec<T, 3>>{};
+  result.reserve(points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    if (!interior[i])
+    {
+      result.push_back(points[i]);
+    }
+  }
+  return result;
+}
+
 } // namespace detail
 
 template <typename T, typename FP, typename VP>
@@ -61,6 +195,11 @@ void Polyhedron<T, FP, VP>::addPoints(std::vector<vm::vec<T, 3>> points)
     points = kdl::vec_sort_and_remove_duplicates(std::move(points));
 
     const auto planeEpsilon = detail::computePlaneEpsilon(points);
+    if (points.size() >= detail::InteriorPointCullingThreshold)
+    {
+      points = detail::removeInteriorPoints<Polyhedron>(std::move(points), planeEpsilon);
+    }
+
     for (const auto& point : points)
     {
       addPoint(point, planeEpsilon);
@@ -327,6 +327,11 @@ bool SmartTag::canDisable() const
   return m_matcher->canDisable();
 }
 
+const TagMatcher& SmartTag::matcher() const
+{
+  return *m_matcher;
+}
+
 void SmartTag::appendToStream(std::ostream& str) const
 {
   kdl::struct_stream{str} << "SmartTag"
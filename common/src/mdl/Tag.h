@@ -408,6 +408,11 @@ public:
    */
   bool canDisable() const;
 
+  /**
+   * Returns the matcher that decides whether to apply this tag to a given taggable.
+   */
+  const TagMatcher& matcher() const;
+
   void appendToStream(std::ostream& str) const override;
 };
 } // namespace tb::mdl
@@ -20,8 +20,11 @@
 #include "TagManager.h"
 
 #include "Ensure.h"
+#include "mdl/BrushFace.h"
 #include "mdl/Tag.h"
+#include "mdl/TagMatcher.h"
 #include "mdl/TagType.h"
+#include "mdl/TagVisitor.h"
 
 #include <fmt/format.h>
 
@@ -31,6 +34,21 @@
 
 namespace tb::mdl
 {
+namespace
+{
+
+class FindBrushFaceVisitor : public TagVisitor
+{
+private:
+  BrushFace* m_face = nullptr;
+
+public:
+  BrushFace* face() const { return m_face; }
+
+  void visit(BrushFace& face) override { m_face = &face; }
+};
+
+} // namespace
 
 bool TagManager::TagCmp::operator()(const SmartTag& lhs, const SmartTag& rhs) const
 {
@@ -104,19 +122,92 @@ void TagManager::registerSmartTags(const std::vector<SmartTag>& tags)
 
     it->setIndex(nextIndex);
   }
+
+  m_materialTagTypes = TagType::NoType;
+  for (const auto& tag : m_smartTags)
+  {
+    if (dynamic_cast<const MaterialTagMatcher*>(&tag.matcher()))
+    {
+      m_materialTagTypes |= tag.type();
+    }
+  }
+  invalidateMaterialTags();
 }
 
 void TagManager::clearSmartTags()
 {
   m_smartTags.clear();
+  m_materialTagTypes = TagType::NoType;
+  invalidateMaterialTags();
 }
 
 void TagManager::updateTags(Taggable& taggable) const
 {
+  if (m_materialTagTypes == TagType::NoType)
+  {
+    for (const auto& tag : m_smartTags)
+    {
+      tag.update(taggable);
+    }
+    return;
+  }
+
+  auto visitor = FindBrushFaceVisitor{};
+  taggable.accept(visitor);
+
+  // material tags can only match brush faces
+  const auto materialTags =
+    visitor.face() ? this->materialTags(*visitor.face()) : TagType::NoType;
+
   for (const auto& tag : m_smartTags)
   {
-    tag.update(taggable);
+    if ((tag.type() & m_materialTagTypes) == 0)
+    {
+      tag.update(taggable);
+    }
+    else if ((tag.type() & materialTags) != 0)
+    {
+      taggable.addTag(tag);
+    }
+    else
+    {
+      taggable.removeTag(tag);
+    }
+  }
+}
+
+void TagManager::invalidateMaterialTags()
+{
+  m_materialTagCache.clear();
+}
+
+TagType::Type TagManager::materialTags(const BrushFace& face) const
+{
+  const auto& materialName = face.attributes().materialName();
+  const auto* material = face.material();
+
+  auto& materialTagsByName = m_materialTagCache[material];
+  if (const auto it = materialTagsByName.find(materialName);
+      it != materialTagsByName.end())
+  {
+    return it->second;
+  }
+
+  auto materialTags = TagType::NoType;
+  for (const auto& tag : m_smartTags)
+  {
+    if ((tag.type() & m_materialTagTypes) != 0)
+    {
+      const auto& matcher = static_cast<const MaterialTagMatcher&>(tag.matcher());
+      if (matcher.matchesFace(materialName, material))
+      {
+        materialTags |= tag.type();
+      }
+    }
   }
+
+  materialTagsByName.emplace(materialName, materialTags);
+  return materialTags;
 }
 
 size_t TagManager::freeTagIndex()
@@ -20,13 +20,17 @@
 #pragma once
 
 #include "mdl/Tag.h"
+#include "mdl/TagType.h"
 
 #include "kdl/vector_set.h"
 
 #include <string>
+#include <unordered_map>
 
 namespace tb::mdl
 {
+class BrushFace;
+class Material;
 
 /**
  * Manages the tags used in a document and updates smart tags on taggable objects.
@@ -44,6 +48,15 @@ private:
 
   kdl::vector_set<SmartTag, TagCmp> m_smartTags;
 
+  // the types of the smart tags whose matchers only depend on the material of a face
+  TagType::Type m_materialTagTypes = TagType::NoType;
+
+  // caches the matching material tags by material and material name
+  mutable std::unordered_map<
+    const Material*,
+    std::unordered_map<std::string, TagType::Type>>
+    m_materialTagCache;
+
 public:
   /**
    * Returns a vector containing all smart tags registered with this manager.
@@ -109,11 +122,21 @@ public:
   /**
    * Update the smart tags of the given taggable object.
    *
+   * Smart tags that only depend on the material of a brush face are matched once per
+   * material and then looked up.
+   *
    * @param taggable the object to update
    */
   void updateTags(Taggable& taggable) const;
 
+  /**
+   * Discards the cached material tags. Must be called when materials are loaded or
+   * unloaded.
+   */
+  void invalidateMaterialTags();
+
 private:
+  TagType::Type materialTags(const BrushFace& face) const;
   size_t freeTagIndex();
 };
 
@@ -98,6 +98,16 @@ public:
 
 } // namespace
 
+bool MaterialTagMatcher::matches(const Taggable& taggable) const
+{
+  auto visitor = BrushFaceMatchVisitor{[&](const auto& face) {
+    return matchesFace(face.attributes().materialName(), face.material());
+  }};
+
+  taggable.accept(visitor);
+  return visitor.matches();
+}
+
 void MaterialTagMatcher::enable(TagMatcherCallback& callback, MapFacade& facade) const
 {
   const auto& materialManager = facade.materialManager();
@@ -165,22 +175,18 @@ std::unique_ptr<TagMatcher> MaterialNameTagMatcher::clone() const
   return std::make_unique<MaterialNameTagMatcher>(m_pattern);
 }
 
-bool MaterialNameTagMatcher::matches(const Taggable& taggable) const
-{
-  auto visitor = BrushFaceMatchVisitor{[&](const auto& face) {
-    return matchesMaterialName(face.attributes().materialName());
-  }};
-
-  taggable.accept(visitor);
-  return visitor.matches();
-}
-
 void MaterialNameTagMatcher::appendToStream(std::ostream& str) const
 {
   kdl::struct_stream{str} << "MaterialNameTagMatcher"
                           << "m_pattern" << m_pattern;
 }
 
+bool MaterialNameTagMatcher::matchesFace(
+  const std::string_view materialName, const Material* /* material */) const
+{
+  return matchesMaterialName(materialName);
+}
+
 bool MaterialNameTagMatcher::matchesMaterial(const Material* material) const
 {
   return material && matchesMaterialName(material->name());
@@ -217,21 +223,18 @@ std::unique_ptr<TagMatcher> SurfaceParmTagMatcher::clone() const
   return std::make_unique<SurfaceParmTagMatcher>(m_parameters);
 }
 
-bool SurfaceParmTagMatcher::matches(const Taggable& taggable) const
-{
-  auto visitor = BrushFaceMatchVisitor{
-    [&](const auto& face) { return matchesMaterial(face.material()); }};
-
-  taggable.accept(visitor);
-  return visitor.matches();
-}
-
 void SurfaceParmTagMatcher::appendToStream(std::ostream& str) const
 {
   kdl::struct_stream{str} << "SurfaceParmTagMatcher"
                           << "m_parameters" << m_parameters;
 }
 
+bool SurfaceParmTagMatcher::matchesFace(
+  const std::string_view /* materialName */, const Material* material) const
+{
+  return matchesMaterial(material);
+}
+
 bool SurfaceParmTagMatcher::matchesMaterial(const Material* material) const
 {
   if (material)
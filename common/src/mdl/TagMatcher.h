@@ -43,10 +43,18 @@ class MapFacade;
 class MaterialTagMatcher : public TagMatcher
 {
 public:
+  bool matches(const Taggable& taggable) const override;
   void enable(TagMatcherCallback& callback, MapFacade& facade) const override;
   bool canEnable() const override;
   void appendToStream(std::ostream& str) const override;
 
+  /**
+   * Indicates whether a brush face with the given material name and material matches.
+   * The result depends on nothing but the given arguments, so it can be cached.
+   */
+  virtual bool matchesFace(
+    std::string_view materialName, const Material* material) const = 0;
+
 private:
   virtual bool matchesMaterial(const Material* material) const = 0;
 };
@@ -59,8 +67,9 @@ private:
 public:
   explicit MaterialNameTagMatcher(std::string pattern);
   std::unique_ptr<TagMatcher> clone() const override;
-  bool matches(const Taggable& taggable) const override;
   void appendToStream(std::ostream& str) const override;
+  bool matchesFace(
+    std::string_view materialName, const Material* material) const override;
 
 private:
   bool matchesMaterial(const Material* material) const override;
@@ -76,8 +85,9 @@ public:
   explicit SurfaceParmTagMatcher(std::string parameter);
   explicit SurfaceParmTagMatcher(kdl::vector_set<std::string> parameters);
   std::unique_ptr<TagMatcher> clone() const override;
-  bool matches(const Taggable& taggable) const override;
   void appendToStream(std::ostream& str) const override;
+  bool matchesFace(
+    std::string_view materialName, const Material* material) const override;
 
 private:
   bool matchesMaterial(const Material* material) const override;
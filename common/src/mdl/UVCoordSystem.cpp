@@ -164,6 +164,24 @@ void UVCoordSystem::rotate(
   attribs.setRotation(attribs.rotation() + actualAngle);
 }
 
+UVProjection UVCoordSystem::projection(
+  const BrushFaceAttributes& attribs, const vm::vec2f& textureSize) const
+{
+  return {
+    safeScaleAxis(uAxis(), attribs.scale().x()),
+    safeScaleAxis(vAxis(), attribs.scale().y()),
+    attribs.offset(),
+    textureSize};
+}
+
+vm::vec2f UVCoordSystem::uvCoords(
+  const vm::vec3d& point,
+  const BrushFaceAttributes& attribs,
+  const vm::vec2f& textureSize) const
+{
+  return projection(attribs, textureSize).uvCoords(point);
+}
+
 vm::mat4x4d UVCoordSystem::toMatrix(const vm::vec2f& o, const vm::vec2f& s) const
 {
   const vm::vec3d u = safeScaleAxis(uAxis(), s.x());
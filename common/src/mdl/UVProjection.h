@@ -0,0 +1,53 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "vm/vec.h"
+
+namespace tb::mdl
+{
+
+/**
+ * Maps points onto the UV plane of a face.
+ *
+ * A projection captures the scaled UV axes of a UV coordinate system together with the
+ * offset and the texture size of a face. Computing UV coordinates with a projection
+ * requires no virtual calls and no material lookups, so when UV coordinates are needed
+ * for many points, the projection should be obtained once and then applied to all
+ * points.
+ *
+ * A projection is a snapshot. It is not updated when the face changes.
+ */
+struct UVProjection
+{
+  vm::vec3d uAxis;
+  vm::vec3d vAxis;
+  vm::vec2f offset;
+  vm::vec2f textureSize;
+
+  vm::vec2f uvCoords(const vm::vec3d& point) const
+  {
+    return (vm::vec2f{float(vm::dot(point, uAxis)), float(vm::dot(point, vAxis))}
+            + offset)
+           / textureSize;
+  }
+};
+
+} // namespace tb::mdl
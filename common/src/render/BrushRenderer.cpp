@@ -97,6 +97,18 @@ bool BrushRenderer::DefaultFilter::visible(
 
 bool BrushRenderer::DefaultFilter::visible(
   const mdl::BrushNode& brushNode, const mdl::BrushEdge& edge) const
+{
+  return visible(brushNode) && visibleInVisibleBrush(brushNode, edge);
+}
+
+bool BrushRenderer::DefaultFilter::visibleInVisibleBrush(
+  const mdl::BrushFace& face) const
+{
+  return !face.hasTag(m_context.hiddenTags());
+}
+
+bool BrushRenderer::DefaultFilter::visibleInVisibleBrush(
+  const mdl::BrushNode& brushNode, const mdl::BrushEdge& edge) const
 {
   const auto& brush = brushNode.brush();
   const auto firstFaceIndex = edge.firstFace()->payload();
@@ -106,8 +118,7 @@ bool BrushRenderer::DefaultFilter::visible(
   const auto& firstFace = brush.face(*firstFaceIndex);
   const auto& secondFace = brush.face(*secondFaceIndex);
 
-  return m_context.visible(&brushNode, firstFace)
-         || m_context.visible(&brushNode, secondFace);
+  return visibleInVisibleBrush(firstFace) || visibleInVisibleBrush(secondFace);
 }
 
 bool BrushRenderer::DefaultFilter::editable(const mdl::BrushNode& brush) const
@@ -446,8 +457,14 @@ static size_t countMarkedEdgeIndices(
     return 0;
   }
 
+  const auto& cachedEdges = brushNode.brushRendererBrushCache().cachedEdges();
+  if (policy == EdgeRenderPolicy::RenderAll)
+  {
+    return 2 * cachedEdges.size();
+  }
+
   size_t indexCount = 0;
-  for (const auto& edge : brushNode.brushRendererBrushCache().cachedEdges())
+  for (const auto& edge : cachedEdges)
   {
     if (shouldRenderEdge(edge, policy))
     {
@@ -470,8 +487,23 @@ static void getMarkedEdgeIndices(
     return;
   }
 
+  const auto& cachedEdges = brushNode.brushRendererBrushCache().cachedEdges();
+  if (policy == EdgeRenderPolicy::RenderAll)
+  {
+    // this is the common case when brushes move between the default and the selection
+    // renderer, so avoid evaluating the policy for every edge
+    for (const auto& edge : cachedEdges)
+    {
+      *(dest++) =
+        static_cast<GLuint>(brushVerticesStartIndex + edge.vertexIndex1RelativeToBrush);
+      *(dest++) =
+        static_cast<GLuint>(brushVerticesStartIndex + edge.vertexIndex2RelativeToBrush);
+    }
+    return;
+  }
+
   size_t i = 0;
-  for (const auto& edge : brushNode.brushRendererBrushCache().cachedEdges())
+  for (const auto& edge : cachedEdges)
   {
     if (shouldRenderEdge(edge, policy))
     {
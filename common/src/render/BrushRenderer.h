@@ -100,6 +100,20 @@ public:
     bool visible(const mdl::BrushNode& brush, const mdl::BrushFace& face) const;
     bool visible(const mdl::BrushNode& brush, const mdl::BrushEdge& edge) const;
 
+    /**
+     * Indicates whether the given face is visible, assuming that its brush is visible.
+     * This is cheaper than evaluating the visibility of the brush again for every face.
+     */
+    bool visibleInVisibleBrush(const mdl::BrushFace& face) const;
+
+    /**
+     * Indicates whether the given edge is visible, assuming that its brush is visible.
+     * When checking several edges of a brush, evaluate the visibility of the brush once
+     * and then call this for every edge.
+     */
+    bool visibleInVisibleBrush(
+      const mdl::BrushNode& brush, const mdl::BrushEdge& edge) const;
+
     bool editable(const mdl::BrushNode& brush) const;
     bool editable(const mdl::BrushNode& brush, const mdl::BrushFace& face) const;
 
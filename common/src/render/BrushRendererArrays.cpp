@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <iterator>
 #include <stdexcept>
 
 // BrushIndexArray
@@ -63,16 +64,70 @@ void DirtyRangeTracker::markDirty(const size_t pos, const size_t size)
     throw std::invalid_argument{"markDirty provided range out of bounds"};
   }
 
-  const auto newPos = std::min(pos, m_dirtyPos);
-  const auto newEnd = std::max(pos + size, m_dirtyPos + m_dirtySize);
+  if (size == 0)
+  {
+    return;
+  }
+
+  // consecutive writes are usually adjacent, so try to extend the most recent range
+  if (!m_dirtyRanges.empty())
+  {
+    auto& last = m_dirtyRanges.back();
+    if (
+      pos <= last.pos + last.size + MergeDistance
+      && last.pos <= pos + size + MergeDistance)
+    {
+      const auto newPos = std::min(pos, last.pos);
+      const auto newEnd = std::max(pos + size, last.pos + last.size);
+      last = DirtyRange{newPos, newEnd - newPos};
+      return;
+    }
+  }
 
-  m_dirtyPos = newPos;
-  m_dirtySize = newEnd - newPos;
+  m_dirtyRanges.push_back(DirtyRange{pos, size});
+  if (m_dirtyRanges.size() > MaxRanges)
+  {
+    mergeRanges();
+  }
 }
 
 bool DirtyRangeTracker::clean() const
 {
-  return m_dirtySize == 0;
+  return m_dirtyRanges.empty();
+}
+
+const std::vector<DirtyRange>& DirtyRangeTracker::dirtyRanges()
+{
+  mergeRanges();
+  return m_dirtyRanges;
+}
+
+void DirtyRangeTracker::mergeRanges()
+{
+  if (m_dirtyRanges.size() < 2)
+  {
+    return;
+  }
+
+  std::sort(
+    m_dirtyRanges.begin(), m_dirtyRanges.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.pos < rhs.pos;
+    });
+
+  auto out = m_dirtyRanges.begin();
+  for (auto it = std::next(m_dirtyRanges.begin()); it != m_dirtyRanges.end(); ++it)
+  {
+    const auto outEnd = out->pos + out->size;
+    if (it->pos <= outEnd + MergeDistance)
+    {
+      out->size = std::max(outEnd, it->pos + it->size) - out->pos;
+    }
+    else
+    {
+      *(++out) = *it;
+    }
+  }
+  m_dirtyRanges.erase(std::next(out), m_dirtyRanges.end());
 }
 
 // IndexHolder
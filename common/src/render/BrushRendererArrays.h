@@ -28,16 +28,43 @@
 #include "render/Vbo.h"
 #include "render/VboManager.h"
 
+#include "kdl/reflection_impl.h"
+
 #include <cassert>
 #include <memory>
 #include <vector>
 
 namespace tb::render
 {
+struct DirtyRange
+{
+  size_t pos = 0;
+  size_t size = 0;
+
+  kdl_reflect_inline(DirtyRange, pos, size);
+};
+
+/**
+ * Tracks the ranges of a buffer that were modified since the last upload.
+ *
+ * Multiple disjoint ranges are tracked so that scattered edits, e.g. when a few brushes
+ * are moved between renderers, do not force the entire span between them to be
+ * uploaded. Ranges that are close to each other are merged since uploading a small gap
+ * is cheaper than issuing another upload call.
+ */
 struct DirtyRangeTracker
 {
-  size_t m_dirtyPos = 0;
-  size_t m_dirtySize = 0;
+  /**
+   * Ranges that are separated by at most this many elements are merged.
+   */
+  static constexpr size_t MergeDistance = 64;
+
+  /**
+   * If more ranges than this have accumulated, they are sorted and merged.
+   */
+  static constexpr size_t MaxRanges = 1024;
+
+  std::vector<DirtyRange> m_dirtyRanges;
   size_t m_capacity = 0;
 
   /**
@@ -53,6 +80,15 @@ struct DirtyRangeTracker
   size_t capacity() const;
   void markDirty(size_t pos, size_t size);
   bool clean() const;
+
+  /**
+   * Returns the dirty ranges sorted by position. The returned ranges are disjoint and
+   * separated by more than MergeDistance elements.
+   */
+  const std::vector<DirtyRange>& dirtyRanges();
+
+private:
+  void mergeRanges();
 };
 
 /**
@@ -61,8 +97,7 @@ struct DirtyRangeTracker
  * Non-copyable; meant to be held in a std::shared_ptr.
  * Able to be resized, and handles copying edits made in the local std::vector to the VBO.
  *
- * Currently uses a single range to track the modified region which might upload much more
- * than necessary; it might be worth mapping the VBO and editing it directly.
+ * Only the modified ranges are uploaded, see DirtyRangeTracker.
  */
 template <typename T>
 class VboHolder
@@ -203,11 +238,8 @@ public:
 
     // otherwise, it's an incremental update of the dirty ranges.
 
-    if (!m_dirtyRange.clean())
+    for (const auto& [pos, size] : m_dirtyRange.dirtyRanges())
     {
-      const size_t pos = m_dirtyRange.m_dirtyPos;
-      const size_t size = m_dirtyRange.m_dirtySize;
-
       const size_t bytesFromStart = pos * sizeof(T);
       m_vbo->writeArray(bytesFromStart, m_snapshot.data() + pos, size);
     }
@@ -70,6 +70,8 @@ void BrushRendererBrushCache::validateVertexCache(const mdl::BrushNode& brushNod
   for (const auto& face : brush.faces())
   {
     const auto indexOfFirstVertexRelativeToBrush = m_cachedVertices.size();
+    const auto uvProjection = face.uvProjection();
+    const auto normal = vm::vec3f{face.boundary().normal};
 
     // The boundary is in CCW order, but the renderer expects CW order:
     auto& boundary = face.geometry()->boundary();
@@ -81,13 +83,14 @@ void BrushRendererBrushCache::validateVertexCache(const mdl::BrushNode& brushNod
       // Set the vertex payload to the index, relative to the brush's first vertex being
       // 0. This is used below when building the edge cache. NOTE: we'll overwrite the
       // payload as we visit the same vertex several times while visiting different faces,
-      // this is fine.
+      // this is fine. Copies of a brush share their geometry, but since their faces are
+      // in the same order, they all write the same payloads.
       const auto currentIndex = m_cachedVertices.size();
       vertex->setPayload(static_cast<GLuint>(currentIndex));
 
       const auto& position = vertex->position();
       m_cachedVertices.emplace_back(
-        vm::vec3f{position}, vm::vec3f{face.boundary().normal}, face.uvCoords(position));
+        vm::vec3f{position}, normal, uvProjection.uvCoords(position));
 
       currentHalfEdge = currentHalfEdge->previous();
     }
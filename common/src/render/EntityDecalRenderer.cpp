@@ -49,7 +49,7 @@ namespace
 std::optional<mdl::DecalSpecification> getDecalSpecification(
   const mdl::EntityNode* entityNode)
 {
-  const auto decalSpec = entityNode->entity().decalSpecification();
+  const auto& decalSpec = entityNode->entity().decalSpecification();
   return decalSpec.materialName.empty() ? std::nullopt : std::make_optional(decalSpec);
 }
 
@@ -134,8 +134,9 @@ std::vector<Vertex> createDecalBrushFace(
 
   // convert the geometry into a list of vertices
   const auto norm = vm::vec3f{plane.normal};
+  const auto uvProjection = uvCoordSystem->projection(attrs, textureSize);
   return kdl::vec_transform(verts, [&](const auto& v) {
-    return Vertex{vm::vec3f{v}, norm, uvCoordSystem->uvCoords(v, attrs, textureSize)};
+    return Vertex{vm::vec3f{v}, norm, uvProjection.uvCoords(v)};
   });
 }
 
@@ -38,6 +38,7 @@
 
 #include <cassert>
 #include <unordered_set>
+#include <vector>
 
 namespace tb::render
 {
@@ -122,19 +123,30 @@ struct CollectTransitiveSelectedLinksVisitor
   Color selectedColor;
 
   std::unordered_set<const mdl::Node*> visited;
+  std::vector<const mdl::EntityNodeBase*> pending;
 
   void visit(
     const mdl::EntityNodeBase& node, std::vector<LinkRenderer::LineVertex>& links)
   {
-    if (editorContext.visible(&node))
+    // follow the links iteratively so that long trigger chains cannot exhaust the stack
+    enqueue(node);
+    while (!pending.empty())
     {
-      if (visited.insert(&node).second)
-      {
-        addSources(node.linkSources(), node, links);
-        addSources(node.killSources(), node, links);
-        addTargets(node, node.linkTargets(), links);
-        addTargets(node, node.killTargets(), links);
-      }
+      const auto& current = *pending.back();
+      pending.pop_back();
+
+      addSources(current.linkSources(), current, links);
+      addSources(current.killSources(), current, links);
+      addTargets(current, current.linkTargets(), links);
+      addTargets(current, current.killTargets(), links);
+    }
+  }
+
+  void enqueue(const mdl::EntityNodeBase& node)
+  {
+    if (editorContext.visible(&node) && visited.insert(&node).second)
+    {
+      pending.push_back(&node);
     }
   }
 
@@ -148,7 +160,7 @@ struct CollectTransitiveSelectedLinksVisitor
       if (editorContext.visible(source))
       {
         addLink(*source, target, defaultColor, selectedColor, links);
-        visit(*source, links);
+        enqueue(*source);
       }
     }
   }
@@ -163,7 +175,7 @@ struct CollectTransitiveSelectedLinksVisitor
       if (editorContext.visible(target))
       {
         addLink(source, *target, defaultColor, selectedColor, links);
-        visit(*target, links);
+        enqueue(*target);
       }
     }
   }
@@ -273,7 +285,7 @@ auto getTransitiveSelectedLinks(
   ui::MapDocument& document, const Color& defaultColor, const Color& selectedColor)
 {
   auto visitor = CollectTransitiveSelectedLinksVisitor{
-    document.editorContext(), defaultColor, selectedColor, {}};
+    document.editorContext(), defaultColor, selectedColor, {}, {}};
   return collectSelectedLinks(document.selectedNodes(), visitor);
 }
 
@@ -0,0 +1,105 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EntityModelInstances.h"
+
+#include "mdl/EntityModel.h" // IWYU pragma: keep
+
+#include "kdl/reflection_impl.h"
+
+#include <unordered_map>
+
+namespace tb::render
+{
+
+kdl_reflect_impl(EntityModelInstanceBatch);
+
+namespace
+{
+
+struct BatchKey
+{
+  const MaterialRenderer* renderer;
+  mdl::Orientation orientation;
+
+  bool operator==(const BatchKey& other) const = default;
+};
+
+struct BatchKeyHash
+{
+  size_t operator()(const BatchKey& key) const
+  {
+    return std::hash<const MaterialRenderer*>{}(key.renderer)
+           ^ (std::hash<int>{}(static_cast<int>(key.orientation)) << 1);
+  }
+};
+
+} // namespace
+
+EntityModelInstances buildEntityModelInstances(
+  const std::vector<EntityModelInstance>& instances)
+{
+  auto result = EntityModelInstances{};
+  auto batchIndices = std::unordered_map<BatchKey, size_t, BatchKeyHash>{};
+
+  // count the instances per batch
+  auto batchIndexPerInstance = std::vector<size_t>{};
+  batchIndexPerInstance.reserve(instances.size());
+
+  for (const auto& instance : instances)
+  {
+    const auto [it, inserted] = batchIndices.try_emplace(
+      BatchKey{instance.renderer, instance.orientation}, result.batches.size());
+    if (inserted)
+    {
+      result.batches.push_back(
+        EntityModelInstanceBatch{instance.renderer, instance.orientation, 0, 0});
+    }
+
+    ++result.batches[it->second].count;
+    batchIndexPerInstance.push_back(it->second);
+  }
+
+  // compute the offsets
+  auto offset = size_t(0);
+  for (auto& batch : result.batches)
+  {
+    batch.offset = offset;
+    offset += batch.count;
+  }
+
+  // scatter the transformations into their batches' ranges
+  auto nextIndexPerBatch = std::vector<size_t>{};
+  nextIndexPerBatch.reserve(result.batches.size());
+  for (const auto& batch : result.batches)
+  {
+    nextIndexPerBatch.push_back(batch.offset);
+  }
+
+  result.transformations.resize(instances.size());
+  for (size_t i = 0; i < instances.size(); ++i)
+  {
+    const auto batchIndex = batchIndexPerInstance[i];
+    result.transformations[nextIndexPerBatch[batchIndex]++] = instances[i].transformation;
+  }
+
+  return result;
+}
+
+} // namespace tb::render
@@ -0,0 +1,83 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "kdl/reflection_decl.h"
+
+#include "vm/mat.h"
+
+#include <vector>
+
+namespace tb::mdl
+{
+enum class Orientation;
+}
+
+namespace tb::render
+{
+class MaterialRenderer;
+
+/**
+ * A single entity model to be rendered with the given renderer and transformation.
+ */
+struct EntityModelInstance
+{
+  MaterialRenderer* renderer = nullptr;
+  mdl::Orientation orientation;
+  vm::mat4x4f transformation;
+};
+
+/**
+ * A contiguous range of per instance transformations that share the same renderer and
+ * orientation, and can therefore be rendered using a single instanced draw.
+ */
+struct EntityModelInstanceBatch
+{
+  MaterialRenderer* renderer = nullptr;
+  mdl::Orientation orientation;
+  size_t offset = 0;
+  size_t count = 0;
+
+  kdl_reflect_decl(EntityModelInstanceBatch, renderer, orientation, offset, count);
+};
+
+/**
+ * The per instance transformations of all batches, stored such that each batch refers to
+ * a contiguous range of transformations.
+ */
+struct EntityModelInstances
+{
+  std::vector<EntityModelInstanceBatch> batches;
+  std::vector<vm::mat4x4f> transformations;
+};
+
+/**
+ * Groups the given instances by renderer and orientation. Since the renderers are shared
+ * between all entities with the same model, frame and skin, each batch contains all
+ * instances of one model frame and skin.
+ *
+ * The batches are ordered by the first occurrence of their renderer and orientation in
+ * the given instances, and the transformations within a batch retain their relative
+ * order.
+ */
+EntityModelInstances buildEntityModelInstances(
+  const std::vector<EntityModelInstance>& instances);
+
+} // namespace tb::render
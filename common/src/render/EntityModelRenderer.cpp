@@ -30,19 +30,56 @@
 #include "mdl/EntityNode.h"
 #include "render/ActiveShader.h"
 #include "render/Camera.h"
+#include "render/GLVertexType.h"
 #include "render/MaterialIndexRangeRenderer.h"
 #include "render/RenderBatch.h"
 #include "render/RenderContext.h"
 #include "render/RenderUtils.h"
 #include "render/Shaders.h"
-#include "render/Transformation.h"
 
 #include "vm/mat.h"
 
+#include <string>
 #include <vector>
 
 namespace tb::render
 {
+namespace
+{
+
+struct InstanceModelMatrix0Name
+{
+  static inline const auto name = std::string{"InstanceModelMatrix0"};
+};
+
+struct InstanceModelMatrix1Name
+{
+  static inline const auto name = std::string{"InstanceModelMatrix1"};
+};
+
+struct InstanceModelMatrix2Name
+{
+  static inline const auto name = std::string{"InstanceModelMatrix2"};
+};
+
+struct InstanceModelMatrix3Name
+{
+  static inline const auto name = std::string{"InstanceModelMatrix3"};
+};
+
+// the columns of an instance's model matrix
+using InstanceVertex = GLVertexType<
+  GLVertexAttributeUserInstanced<InstanceModelMatrix0Name, GL_FLOAT, 4, false>,
+  GLVertexAttributeUserInstanced<InstanceModelMatrix1Name, GL_FLOAT, 4, false>,
+  GLVertexAttributeUserInstanced<InstanceModelMatrix2Name, GL_FLOAT, 4, false>,
+  GLVertexAttributeUserInstanced<InstanceModelMatrix3Name, GL_FLOAT, 4, false>>::Vertex;
+
+bool instancedRenderingSupported()
+{
+  return GLEW_ARB_instanced_arrays && GLEW_ARB_draw_instanced;
+}
+
+} // namespace
 
 EntityModelRenderer::EntityModelRenderer(
   Logger& logger,
@@ -70,12 +107,16 @@ void EntityModelRenderer::addEntity(const mdl::EntityNode* entityNode)
   if (renderer != nullptr)
   {
     m_entities.emplace(entityNode, renderer);
+    invalidateInstances();
   }
 }
 
 void EntityModelRenderer::removeEntity(const mdl::EntityNode* entityNode)
 {
-  m_entities.erase(entityNode);
+  if (m_entities.erase(entityNode) > 0)
+  {
+    invalidateInstances();
+  }
 }
 
 void EntityModelRenderer::updateEntity(const mdl::EntityNode* entityNode)
@@ -93,6 +134,9 @@ void EntityModelRenderer::updateEntity(const mdl::EntityNode* entityNode)
     return;
   }
 
+  // the entity's transformation may have changed even if its renderer didn't
+  invalidateInstances();
+
   if (it == std::end(m_entities))
   {
     m_entities.emplace(entityNode, renderer);
@@ -113,6 +157,7 @@ void EntityModelRenderer::updateEntity(const mdl::EntityNode* entityNode)
 void EntityModelRenderer::clear()
 {
   m_entities.clear();
+  invalidateInstances();
 }
 
 bool EntityModelRenderer::applyTinting() const
@@ -142,7 +187,11 @@ bool EntityModelRenderer::showHiddenEntities() const
 
 void EntityModelRenderer::setShowHiddenEntities(const bool showHiddenEntities)
 {
-  m_showHiddenEntities = showHiddenEntities;
+  if (showHiddenEntities != m_showHiddenEntities)
+  {
+    m_showHiddenEntities = showHiddenEntities;
+    invalidateInstances();
+  }
 }
 
 void EntityModelRenderer::render(RenderBatch& renderBatch)
@@ -150,14 +199,83 @@ void EntityModelRenderer::render(RenderBatch& renderBatch)
   renderBatch.add(this);
 }
 
+void EntityModelRenderer::invalidateInstances()
+{
+  m_instancesValid = false;
+}
+
+void EntityModelRenderer::validateInstances()
+{
+  // Visibility changes are not tracked by invalidation, so we collect the visible
+  // entities and only rebuild the instances if they differ from the previous ones.
+  auto visibleEntities = std::vector<const mdl::EntityNode*>{};
+  visibleEntities.reserve(m_entities.size());
+
+  for (const auto& [entityNode, renderer] : m_entities)
+  {
+    const auto* model = entityNode->entity().model();
+    if (
+      model && model->data()
+      && (m_showHiddenEntities || m_editorContext.visible(entityNode)))
+    {
+      visibleEntities.push_back(entityNode);
+    }
+  }
+
+  if (m_instancesValid && visibleEntities == m_instancedEntities)
+  {
+    return;
+  }
+
+  auto instances = std::vector<EntityModelInstance>{};
+  instances.reserve(visibleEntities.size());
+
+  if (!visibleEntities.empty())
+  {
+    const auto& propertyConfig = visibleEntities.front()->entityPropertyConfig();
+    const auto& defaultModelScaleExpression = propertyConfig.defaultModelScaleExpression;
+
+    for (const auto* entityNode : visibleEntities)
+    {
+      const auto& entity = entityNode->entity();
+      instances.push_back(EntityModelInstance{
+        m_entities.at(entityNode),
+        entity.model()->data()->orientation(),
+        vm::mat4x4f{entity.modelTransformation(defaultModelScaleExpression)},
+      });
+    }
+  }
+
+  auto [batches, transformations] = buildEntityModelInstances(instances);
+
+  auto instanceVertices = std::vector<InstanceVertex>{};
+  instanceVertices.reserve(transformations.size());
+  for (const auto& transformation : transformations)
+  {
+    instanceVertices.emplace_back(
+      transformation[0], transformation[1], transformation[2], transformation[3]);
+  }
+
+  m_instancedEntities = std::move(visibleEntities);
+  m_instanceBatches = std::move(batches);
+  m_instanceArray = VertexArray::move(std::move(instanceVertices));
+  m_instancesValid = true;
+}
+
 void EntityModelRenderer::doPrepareVertices(VboManager& vboManager)
 {
   m_entityModelManager.prepare(vboManager);
+
+  validateInstances();
+  if (instancedRenderingSupported())
+  {
+    m_instanceArray.prepare(vboManager);
+  }
 }
 
 void EntityModelRenderer::doRender(RenderContext& renderContext)
 {
-  if (!m_entities.empty())
+  if (!m_instanceBatches.empty())
   {
     auto& prefs = PreferenceManager::instance();
 
@@ -187,37 +305,56 @@ void EntityModelRenderer::doRender(RenderContext& renderContext)
     shader.set("CameraUp", renderContext.camera().up());
     shader.set("ViewMatrix", renderContext.camera().viewMatrix());
 
-    const auto& propertyConfig = m_entities.begin()->first->entityPropertyConfig();
-    const auto& defaultModelScaleExpression = propertyConfig.defaultModelScaleExpression;
-
-    for (const auto& [entityNode, renderer] : m_entities)
+    if (instancedRenderingSupported() && m_instanceArray.prepared())
     {
-      if (!m_showHiddenEntities && !m_editorContext.visible(entityNode))
-      {
-        continue;
-      }
-
-      const auto* model = entityNode->entity().model();
-      const auto* modelData = model ? model->data() : nullptr;
-      if (!modelData)
-      {
-        continue;
-      }
-
-      shader.set("Orientation", static_cast<int>(modelData->orientation()));
+      renderInstanced(shader, renderContext);
+    }
+    else
+    {
+      renderIndividually(shader, renderContext);
+    }
+  }
+}
 
-      const auto transformation = vm::mat4x4f{
-        entityNode->entity().modelTransformation(defaultModelScaleExpression)};
-      const auto multMatrix =
-        MultiplyModelMatrix{renderContext.transformation(), transformation};
+void EntityModelRenderer::renderInstanced(
+  ActiveShader& shader, RenderContext& renderContext)
+{
+  shader.set("UseInstanceModelMatrix", true);
 
-      shader.set("ModelMatrix", transformation);
+  for (const auto& batch : m_instanceBatches)
+  {
+    shader.set("Orientation", static_cast<int>(batch.orientation));
 
+    if (m_instanceArray.setup(batch.offset))
+    {
       auto renderFunc = DefaultMaterialRenderFunc{
         renderContext.minFilterMode(), renderContext.magFilterMode()};
-      renderer->render(renderFunc);
+      batch.renderer->renderInstanced(renderFunc, batch.count);
+      m_instanceArray.cleanup();
     }
   }
 }
 
+void EntityModelRenderer::renderIndividually(
+  ActiveShader& shader, RenderContext& renderContext)
+{
+  shader.set("UseInstanceModelMatrix", false);
+
+  const auto& propertyConfig = m_instancedEntities.front()->entityPropertyConfig();
+  const auto& defaultModelScaleExpression = propertyConfig.defaultModelScaleExpression;
+
+  for (const auto* entityNode : m_instancedEntities)
+  {
+    const auto& entity = entityNode->entity();
+    shader.set("Orientation", static_cast<int>(entity.model()->data()->orientation()));
+    shader.set(
+      "ModelMatrix",
+      vm::mat4x4f{entity.modelTransformation(defaultModelScaleExpression)});
+
+    auto renderFunc = DefaultMaterialRenderFunc{
+      renderContext.minFilterMode(), renderContext.magFilterMode()};
+    m_entities.at(entityNode)->render(renderFunc);
+  }
+}
+
 } // namespace tb::render
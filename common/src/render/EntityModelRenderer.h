@@ -20,9 +20,12 @@
 #pragma once
 
 #include "Color.h"
+#include "render/EntityModelInstances.h"
 #include "render/Renderable.h"
+#include "render/VertexArray.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace tb
 {
@@ -38,6 +41,7 @@ class EntityNode;
 
 namespace tb::render
 {
+class ActiveShader;
 class RenderBatch;
 struct ShaderConfig;
 class MaterialRenderer;
@@ -52,6 +56,12 @@ private:
 
   std::unordered_map<const mdl::EntityNode*, MaterialRenderer*> m_entities;
 
+  // the entities that were visible when the instances were last built
+  std::vector<const mdl::EntityNode*> m_instancedEntities;
+  std::vector<EntityModelInstanceBatch> m_instanceBatches;
+  VertexArray m_instanceArray;
+  bool m_instancesValid = false;
+
   bool m_applyTinting = false;
   Color m_tintColor;
 
@@ -107,8 +117,14 @@ public:
   void render(RenderBatch& renderBatch);
 
 private:
+  void invalidateInstances();
+  void validateInstances();
+
   void doPrepareVertices(VboManager& vboManager) override;
   void doRender(RenderContext& renderContext) override;
+
+  void renderInstanced(ActiveShader& shader, RenderContext& renderContext);
+  void renderIndividually(ActiveShader& shader, RenderContext& renderContext);
 };
 
 } // namespace tb::render
@@ -79,6 +79,61 @@ public:
   deleteCopyAndMove(GLVertexAttributeUser);
 };
 
+/**
+ * User defined per instance vertex attribute types. Such attributes advance once per
+ * rendered instance instead of once per vertex, see VertexArray::renderInstanced.
+ *
+ * Requires support for GL_ARB_instanced_arrays.
+ *
+ * @tparam A class containing the attribute name in a `static inline const std::string`
+ * member called `name`
+ * @tparam D the vertex component type
+ * @tparam S the number of components
+ * @tparam N whether to normalize signed integer types to [-1..1] and unsigned to [0..1]
+ */
+template <class A, GLenum D, size_t S, bool N>
+class GLVertexAttributeUserInstanced
+{
+public:
+  using ComponentType = typename GLType<D>::Type;
+  using ElementType = vm::vec<ComponentType, S>;
+  static const size_t Size = sizeof(ElementType);
+  static const bool Normalize = N;
+
+  static void setup(
+    ShaderProgram* program,
+    const size_t /* index */,
+    const size_t stride,
+    const size_t offset)
+  {
+    ensure(program != nullptr, "must have a program bound to use generic attributes");
+
+    const auto attributeIndex = program->findAttributeLocation(A::name);
+    glAssert(glEnableVertexAttribArray(static_cast<GLuint>(attributeIndex)));
+    glAssert(glVertexAttribPointer(
+      static_cast<GLuint>(attributeIndex),
+      static_cast<GLint>(S),
+      D,
+      Normalize ? GL_TRUE : GL_FALSE,
+      static_cast<GLsizei>(stride),
+      reinterpret_cast<GLvoid*>(offset)));
+    glAssert(glVertexAttribDivisorARB(static_cast<GLuint>(attributeIndex), 1));
+  }
+
+  static void cleanup(ShaderProgram* program, const size_t /* index */)
+  {
+    ensure(program != nullptr, "must have a program bound to use generic attributes");
+
+    const auto attributeIndex = program->findAttributeLocation(A::name);
+    glAssert(glVertexAttribDivisorARB(static_cast<GLuint>(attributeIndex), 0));
+    glAssert(glDisableVertexAttribArray(static_cast<GLuint>(attributeIndex)));
+  }
+
+  // Non-instantiable
+  GLVertexAttributeUserInstanced() = delete;
+  deleteCopyAndMove(GLVertexAttributeUserInstanced);
+};
+
 /**
  * Vertex position attribute types.
  *
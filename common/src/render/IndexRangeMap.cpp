@@ -181,6 +181,23 @@ void IndexRangeMap::render(VertexArray& vertexArray) const
   }
 }
 
+void IndexRangeMap::renderInstanced(
+  VertexArray& vertexArray, const size_t instanceCount) const
+{
+  for (const auto& primType : PrimTypeValues)
+  {
+    const auto& indicesAndCounts = m_data->get(primType);
+    for (size_t i = 0; i < indicesAndCounts.size(); ++i)
+    {
+      vertexArray.renderInstanced(
+        primType,
+        indicesAndCounts.indices[i],
+        indicesAndCounts.counts[i],
+        static_cast<GLsizei>(instanceCount));
+    }
+  }
+}
+
 void IndexRangeMap::forEachPrimitive(
   std::function<void(PrimType, size_t, size_t)> func) const
 {
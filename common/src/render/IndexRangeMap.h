@@ -156,6 +156,16 @@ public:
    */
   void render(VertexArray& vertexArray) const;
 
+  /**
+   * Renders the given number of instances of the primitives stored in this index range
+   * map using the vertices in the given vertex array. Since there is no instanced variant
+   * of glMultiDrawArrays, each range is rendered with a separate draw call.
+   *
+   * @param vertexArray the vertex array to render with
+   * @param instanceCount the number of instances to render
+   */
+  void renderInstanced(VertexArray& vertexArray, size_t instanceCount) const;
+
   /**
    * Invokes the given function for each primitive stored in this map.
    *
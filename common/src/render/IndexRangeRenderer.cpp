@@ -37,6 +37,11 @@ void IndexRangeRenderer::prepare(VboManager& vboManager)
   m_vertexArray.prepare(vboManager);
 }
 
+void IndexRangeRenderer::stream(VboManager& vboManager)
+{
+  m_vertexArray.stream(vboManager);
+}
+
 void IndexRangeRenderer::render()
 {
   if (m_vertexArray.setup())
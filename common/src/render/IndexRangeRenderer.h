@@ -45,6 +45,7 @@ public:
   IndexRangeRenderer(VertexArray vertexArray, IndexRangeMap indexArray);
 
   void prepare(VboManager& vboManager);
+  void stream(VboManager& vboManager);
   void render();
 };
 
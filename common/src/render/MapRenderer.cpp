@@ -49,6 +49,7 @@
 #include "kdl/overload.h"
 #include "kdl/path_utils.h"
 
+#include <unordered_set>
 #include <vector>
 
 namespace tb::render
@@ -132,7 +133,8 @@ public:
     auto anyFaceVisible = false;
     for (const auto& face : brush.faces())
     {
-      const bool faceVisible = !selected(brushNode, face) && visible(brushNode, face);
+      const bool faceVisible =
+        !selected(brushNode, face) && visibleInVisibleBrush(face);
       face.setMarked(faceVisible);
       anyFaceVisible |= faceVisible;
     }
@@ -187,6 +189,39 @@ std::unique_ptr<EntityDecalRenderer> createEntityDecalRenderer(
   return std::make_unique<EntityDecalRenderer>(document);
 }
 
+/**
+ * Calls the given function for every node whose rendering depends on the given node,
+ * i.e. the node itself, its descendants (so that selecting a group renders its contents
+ * selected), and its parent. Worlds and layers in the given subtree are only traversed,
+ * but the parent is passed as is, so it may be a layer or the world.
+ */
+template <typename F>
+void visitNodesAffectedBy(mdl::Node* node, const F& f)
+{
+  node->accept(kdl::overload(
+    [](auto&& thisLambda, mdl::WorldNode* world) { world->visitChildren(thisLambda); },
+    [](auto&& thisLambda, mdl::LayerNode* layer) { layer->visitChildren(thisLambda); },
+    [&](auto&& thisLambda, mdl::GroupNode* group) {
+      f(group);
+      group->visitChildren(thisLambda);
+    },
+    [&](auto&& thisLambda, mdl::EntityNode* entity) {
+      f(entity);
+      entity->visitChildren(thisLambda);
+    },
+    [&](mdl::BrushNode* brush) { f(brush); },
+    [&](mdl::PatchNode* patchNode) { f(patchNode); }));
+
+  // Due to the definition of `selected()` below, we also need to update the parent.
+  // (not recursively, though, so this has little performance impact.)
+  // This handles clicking on a brush in a brush entity -> the entity label needs to
+  // render as selected.
+  if (node->parent())
+  {
+    f(node->parent());
+  }
+}
+
 } // namespace
 
 MapRenderer::MapRenderer(std::weak_ptr<ui::MapDocument> document)
@@ -521,28 +556,7 @@ void MapRenderer::updateAndInvalidateNode(mdl::Node* node)
 
 void MapRenderer::updateAndInvalidateNodeRecursive(mdl::Node* node)
 {
-  node->accept(kdl::overload(
-    [](auto&& thisLambda, mdl::WorldNode* world) { world->visitChildren(thisLambda); },
-    [](auto&& thisLambda, mdl::LayerNode* layer) { layer->visitChildren(thisLambda); },
-    [&](auto&& thisLambda, mdl::GroupNode* group) {
-      updateAndInvalidateNode(group);
-      group->visitChildren(thisLambda);
-    },
-    [&](auto&& thisLambda, mdl::EntityNode* entity) {
-      updateAndInvalidateNode(entity);
-      entity->visitChildren(thisLambda);
-    },
-    [&](mdl::BrushNode* brush) { updateAndInvalidateNode(brush); },
-    [&](mdl::PatchNode* patchNode) { updateAndInvalidateNode(patchNode); }));
-
-  // Due to the definition of `selected()` above, we also need to update the parent.
-  // (not recursively, though, so this has little performance impact.)
-  // This handles clicking on a brush in a brush entity -> the entity label needs to
-  // render as selected.
-  if (node->parent())
-  {
-    updateAndInvalidateNode(node->parent());
-  }
+  visitNodesAffectedBy(node, [&](mdl::Node* n) { updateAndInvalidateNode(n); });
 }
 
 void MapRenderer::removeNode(mdl::Node* node)
@@ -776,23 +790,39 @@ void MapRenderer::brushFacesDidChange(const std::vector<mdl::BrushFaceHandle>& f
 
 void MapRenderer::selectionDidChange(const ui::Selection& selection)
 {
+  // Collect the affected nodes first so that every node is updated only once. Without
+  // this, the parent of the selected nodes would be updated once per child, which is
+  // expensive for large brush entities.
+  auto nodesToUpdate = std::vector<mdl::Node*>{};
+  auto visitedNodes = std::unordered_set<mdl::Node*>{};
+
+  const auto addNode = [&](mdl::Node* node) {
+    if (visitedNodes.insert(node).second)
+    {
+      nodesToUpdate.push_back(node);
+    }
+  };
+
   for (const auto& face : selection.deselectedBrushFaces())
   {
-    updateAndInvalidateNode(face.node());
+    addNode(face.node());
   }
   for (const auto& face : selection.selectedBrushFaces())
   {
-    updateAndInvalidateNode(face.node());
+    addNode(face.node());
   }
-  // These need to be recursive otherwise selecting a Group doesn't render the contents
-  // selected
   for (auto* node : selection.deselectedNodes())
   {
-    updateAndInvalidateNodeRecursive(node);
+    visitNodesAffectedBy(node, addNode);
   }
   for (auto* node : selection.selectedNodes())
   {
-    updateAndInvalidateNodeRecursive(node);
+    visitNodesAffectedBy(node, addNode);
+  }
+
+  for (auto* node : nodesToUpdate)
+  {
+    updateAndInvalidateNode(node);
   }
 
   invalidateEntityLinkRenderer();
@@ -140,6 +140,17 @@ void MaterialIndexRangeMap::render(VertexArray& vertexArray, MaterialRenderFunc&
   }
 }
 
+void MaterialIndexRangeMap::renderInstanced(
+  VertexArray& vertexArray, MaterialRenderFunc& func, const size_t instanceCount)
+{
+  for (const auto& [material, indexArray] : *m_data)
+  {
+    func.before(material);
+    indexArray.renderInstanced(vertexArray, instanceCount);
+    func.after(material);
+  }
+}
+
 void MaterialIndexRangeMap::forEachPrimitive(
   std::function<void(const Material*, PrimType, size_t, size_t)> func) const
 {
@@ -46,6 +46,7 @@ namespace tb::render
 
 PatchRenderer::PatchRenderer(const mdl::EditorContext& editorContext)
   : m_editorContext{editorContext}
+  , m_lodMeshes(mdl::PatchNode::DefaultSubdivisionsPerSurface + 1u)
 {
 }
 
@@ -97,6 +98,8 @@ void PatchRenderer::setOccludedEdgeColor(const Color& occludedEdgeColor)
 void PatchRenderer::invalidate()
 {
   m_valid = false;
+  m_meshValid = false;
+  m_lodSubdivisionsValid = false;
 }
 
 void PatchRenderer::clear()
@@ -136,6 +139,17 @@ void PatchRenderer::render(RenderContext& renderContext, RenderBatch& renderBatc
 
   if (renderContext.showFaces())
   {
+    m_renderLodMesh = !renderContext.camera().orthographicProjection();
+    if (m_renderLodMesh)
+    {
+      validateLodMeshes(vm::vec3d{renderContext.camera().position()});
+    }
+    else
+    {
+      validateMesh();
+    }
+    releaseUnusedMeshes();
+
     renderBatch.add(this);
   }
 
@@ -149,24 +163,25 @@ void PatchRenderer::render(RenderContext& renderContext, RenderBatch& renderBatc
   }
 }
 
+/**
+ * Builds a mesh for the given patches. The given function returns the grid to use for the
+ * patch at the given index.
+ */
+template <typename GetGrid>
 static MaterialIndexArrayRenderer buildMeshRenderer(
-  const std::vector<const mdl::PatchNode*>& patchNodes,
-  const mdl::EditorContext& editorContext)
+  const std::vector<const mdl::PatchNode*>& patchNodes, const GetGrid& getGrid)
 {
   size_t vertexCount = 0u;
   auto indexArrayMapSize = MaterialIndexArrayMap::Size{};
 
-  for (const auto* patchNode : patchNodes)
+  for (size_t i = 0u; i < patchNodes.size(); ++i)
   {
-    if (editorContext.visible(patchNode))
-    {
-      vertexCount += patchNode->grid().pointRowCount * patchNode->grid().pointColumnCount;
+    const auto& grid = getGrid(i);
+    vertexCount += grid.pointRowCount * grid.pointColumnCount;
 
-      const auto* material = patchNode->patch().material();
-      const auto quadCount =
-        patchNode->grid().quadRowCount() * patchNode->grid().quadColumnCount();
-      indexArrayMapSize.inc(material, PrimType::Triangles, 6u * quadCount);
-    }
+    const auto* material = patchNodes[i]->patch().material();
+    const auto quadCount = grid.quadRowCount() * grid.quadColumnCount();
+    indexArrayMapSize.inc(material, PrimType::Triangles, 6u * quadCount);
   }
 
   using Vertex = GLVertexTypes::P3NT2::Vertex;
@@ -176,41 +191,39 @@ static MaterialIndexArrayRenderer buildMeshRenderer(
   auto indexArrayMapBuilder = MaterialIndexArrayMapBuilder{indexArrayMapSize};
   using Index = MaterialIndexArrayMapBuilder::Index;
 
-  for (const auto* patchNode : patchNodes)
+  for (size_t i = 0u; i < patchNodes.size(); ++i)
   {
-    if (editorContext.visible(patchNode))
-    {
-      const auto vertexOffset = vertices.size();
+    const auto* patchNode = patchNodes[i];
+    const auto vertexOffset = vertices.size();
 
-      const auto& grid = patchNode->grid();
-      auto gridVertices = kdl::vec_transform(grid.points, [](const auto& p) {
-        return Vertex{vm::vec3f{p.position}, vm::vec3f{p.normal}, vm::vec2f{p.uvCoords}};
-      });
-      vertices = kdl::vec_concat(std::move(vertices), std::move(gridVertices));
+    const auto& grid = getGrid(i);
+    auto gridVertices = kdl::vec_transform(grid.points, [](const auto& p) {
+      return Vertex{vm::vec3f{p.position}, vm::vec3f{p.normal}, vm::vec2f{p.uvCoords}};
+    });
+    vertices = kdl::vec_concat(std::move(vertices), std::move(gridVertices));
 
-      const auto* material = patchNode->patch().material();
+    const auto* material = patchNode->patch().material();
 
-      const auto pointsPerRow = grid.pointColumnCount;
-      for (size_t row = 0u; row < grid.quadRowCount(); ++row)
+    const auto pointsPerRow = grid.pointColumnCount;
+    for (size_t row = 0u; row < grid.quadRowCount(); ++row)
+    {
+      for (size_t col = 0u; col < grid.quadColumnCount(); ++col)
       {
-        for (size_t col = 0u; col < grid.quadColumnCount(); ++col)
-        {
-          const auto i0 = vertexOffset + row * pointsPerRow + col;
-          const auto i1 = vertexOffset + row * pointsPerRow + col + 1u;
-          const auto i2 = vertexOffset + (row + 1u) * pointsPerRow + col + 1u;
-          const auto i3 = vertexOffset + (row + 1u) * pointsPerRow + col;
-
-          indexArrayMapBuilder.addTriangle(
-            material,
-            static_cast<Index>(i0),
-            static_cast<Index>(i1),
-            static_cast<Index>(i2));
-          indexArrayMapBuilder.addTriangle(
-            material,
-            static_cast<Index>(i2),
-            static_cast<Index>(i3),
-            static_cast<Index>(i0));
-        }
+        const auto i0 = vertexOffset + row * pointsPerRow + col;
+        const auto i1 = vertexOffset + row * pointsPerRow + col + 1u;
+        const auto i2 = vertexOffset + (row + 1u) * pointsPerRow + col + 1u;
+        const auto i3 = vertexOffset + (row + 1u) * pointsPerRow + col;
+
+        indexArrayMapBuilder.addTriangle(
+          material,
+          static_cast<Index>(i0),
+          static_cast<Index>(i1),
+          static_cast<Index>(i2));
+        indexArrayMapBuilder.addTriangle(
+          material,
+          static_cast<Index>(i2),
+          static_cast<Index>(i3),
+          static_cast<Index>(i0));
       }
     }
   }
@@ -223,21 +236,40 @@ static MaterialIndexArrayRenderer buildMeshRenderer(
     std::move(indexArrayMapBuilder.ranges())};
 }
 
+/**
+ * Builds a mesh for the given patches tessellated with the given number of subdivisions
+ * per surface.
+ */
+static MaterialIndexArrayRenderer buildLodMeshRenderer(
+  const std::vector<const mdl::PatchNode*>& patchNodes, const size_t subdivisions)
+{
+  if (subdivisions >= mdl::PatchNode::DefaultSubdivisionsPerSurface)
+  {
+    return buildMeshRenderer(patchNodes, [&](const size_t i) -> const mdl::PatchGrid& {
+      return patchNodes[i]->grid();
+    });
+  }
+
+  // Coarser grids are not kept by the patch nodes, they are only needed until the mesh
+  // is built.
+  const auto grids = kdl::vec_transform(patchNodes, [&](const auto* patchNode) {
+    return mdl::makePatchGrid(patchNode->patch(), subdivisions);
+  });
+  return buildMeshRenderer(
+    patchNodes, [&](const size_t i) -> const mdl::PatchGrid& { return grids[i]; });
+}
+
 static DirectEdgeRenderer buildEdgeRenderer(
-  const std::vector<const mdl::PatchNode*>& patchNodes,
-  const mdl::EditorContext& editorContext)
+  const std::vector<const mdl::PatchNode*>& patchNodes)
 {
   size_t vertexCount = 0u;
   auto indexRangeMapSize = IndexRangeMap::Size{};
 
   for (const auto* patchNode : patchNodes)
   {
-    if (editorContext.visible(patchNode))
-    {
-      vertexCount +=
-        (patchNode->grid().pointRowCount + patchNode->grid().pointColumnCount - 2u) * 2u;
-      indexRangeMapSize.inc(PrimType::LineLoop, vertexCount);
-    }
+    vertexCount +=
+      (patchNode->grid().pointRowCount + patchNode->grid().pointColumnCount - 2u) * 2u;
+    indexRangeMapSize.inc(PrimType::LineLoop, vertexCount);
   }
 
   auto indexRangeMapBuilder =
@@ -245,50 +277,47 @@ static DirectEdgeRenderer buildEdgeRenderer(
 
   for (const auto* patchNode : patchNodes)
   {
-    if (editorContext.visible(patchNode))
-    {
-      const auto& grid = patchNode->grid();
-
-      auto edgeLoopVertices = std::vector<GLVertexTypes::P3::Vertex>{};
-      edgeLoopVertices.reserve((grid.pointRowCount + grid.pointColumnCount - 2u) * 2u);
+    const auto& grid = patchNode->grid();
 
-      // walk around the patch to collect the edge vertices
-      // for each side, collect the first vertex up to but not including the last vertex
+    auto edgeLoopVertices = std::vector<GLVertexTypes::P3::Vertex>{};
+    edgeLoopVertices.reserve((grid.pointRowCount + grid.pointColumnCount - 2u) * 2u);
 
-      const auto t = 0u;
-      const auto b = grid.pointRowCount - 1u;
-      const auto l = 0u;
-      const auto r = grid.pointColumnCount - 1u;
+    // walk around the patch to collect the edge vertices
+    // for each side, collect the first vertex up to but not including the last vertex
 
-      auto row = t;
-      auto col = l;
+    const auto t = 0u;
+    const auto b = grid.pointRowCount - 1u;
+    const auto l = 0u;
+    const auto r = grid.pointColumnCount - 1u;
 
-      while (col < r)
-      {
-        edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row, col++).position});
-      }
-      assert(row == t && col == r);
+    auto row = t;
+    auto col = l;
 
-      while (row < b)
-      {
-        edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row++, col).position});
-      }
-      assert(row == b && col == r);
+    while (col < r)
+    {
+      edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row, col++).position});
+    }
+    assert(row == t && col == r);
 
-      while (col > l)
-      {
-        edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row, col--).position});
-      }
-      assert(row == b && col == l);
+    while (row < b)
+    {
+      edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row++, col).position});
+    }
+    assert(row == b && col == r);
 
-      while (row > t)
-      {
-        edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row--, col).position});
-      }
-      assert(row == t && col == l);
+    while (col > l)
+    {
+      edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row, col--).position});
+    }
+    assert(row == b && col == l);
 
-      indexRangeMapBuilder.addLineLoop(edgeLoopVertices);
+    while (row > t)
+    {
+      edgeLoopVertices.emplace_back(vm::vec3f{grid.point(row--, col).position});
     }
+    assert(row == t && col == l);
+
+    indexRangeMapBuilder.addLineLoop(edgeLoopVertices);
   }
 
   auto vertexArray = VertexArray::move(std::move(indexRangeMapBuilder.vertices()));
@@ -300,16 +329,119 @@ void PatchRenderer::validate()
 {
   if (!m_valid)
   {
-    m_patchMeshRenderer = buildMeshRenderer(m_patchNodes.get_data(), m_editorContext);
-    m_edgeRenderer = buildEdgeRenderer(m_patchNodes.get_data(), m_editorContext);
+    m_visiblePatchNodes = kdl::vec_filter(
+      m_patchNodes.get_data(),
+      [&](const auto* patchNode) { return m_editorContext.visible(patchNode); });
+    m_edgeRenderer = buildEdgeRenderer(m_visiblePatchNodes);
 
     m_valid = true;
   }
 }
 
+void PatchRenderer::validateMesh()
+{
+  if (!m_meshValid)
+  {
+    const auto getGrid = [&](const size_t i) -> const mdl::PatchGrid& {
+      return m_visiblePatchNodes[i]->grid();
+    };
+    m_patchMeshRenderer = buildMeshRenderer(m_visiblePatchNodes, getGrid);
+    m_meshValid = true;
+  }
+}
+
+void PatchRenderer::validateLodMeshes(const vm::vec3d& viewPosition)
+{
+  if (!m_lodSubdivisionsValid)
+  {
+    m_lodSubdivisions =
+      kdl::vec_transform(m_visiblePatchNodes, [&](const auto* patchNode) {
+        return mdl::selectPatchSubdivisions(patchNode->grid().bounds, viewPosition);
+      });
+    for (auto& lodMesh : m_lodMeshes)
+    {
+      lodMesh.valid = false;
+    }
+    m_lodSubdivisionsValid = true;
+  }
+  else
+  {
+    for (size_t i = 0u; i < m_visiblePatchNodes.size(); ++i)
+    {
+      auto& subdivisions = m_lodSubdivisions[i];
+      const auto newSubdivisions = mdl::selectPatchSubdivisions(
+        m_visiblePatchNodes[i]->grid().bounds, viewPosition, subdivisions);
+      if (newSubdivisions != subdivisions)
+      {
+        m_lodMeshes[subdivisions].valid = false;
+        m_lodMeshes[newSubdivisions].valid = false;
+        subdivisions = newSubdivisions;
+      }
+    }
+  }
+
+  for (size_t subdivisions = 0u; subdivisions < m_lodMeshes.size(); ++subdivisions)
+  {
+    auto& lodMesh = m_lodMeshes[subdivisions];
+    if (!lodMesh.valid)
+    {
+      auto patchNodes = std::vector<const mdl::PatchNode*>{};
+      for (size_t i = 0u; i < m_visiblePatchNodes.size(); ++i)
+      {
+        if (m_lodSubdivisions[i] == subdivisions)
+        {
+          patchNodes.push_back(m_visiblePatchNodes[i]);
+        }
+      }
+      lodMesh.renderer = buildLodMeshRenderer(patchNodes, subdivisions);
+      lodMesh.valid = true;
+    }
+  }
+}
+
+void PatchRenderer::releaseUnusedMeshes()
+{
+  // Perspective and orthographic views share this renderer, so a mesh is only released
+  // once it has not been used for this many renders.
+  constexpr auto MaxRendersWithoutUse = size_t(64);
+
+  if (m_renderLodMesh)
+  {
+    m_rendersWithoutLodMeshes = 0u;
+    if (++m_rendersWithoutMesh > MaxRendersWithoutUse && m_meshValid)
+    {
+      m_patchMeshRenderer = MaterialIndexArrayRenderer{};
+      m_meshValid = false;
+    }
+  }
+  else
+  {
+    m_rendersWithoutMesh = 0u;
+    if (++m_rendersWithoutLodMeshes > MaxRendersWithoutUse && m_lodSubdivisionsValid)
+    {
+      for (auto& lodMesh : m_lodMeshes)
+      {
+        lodMesh = LodMesh{};
+      }
+      m_lodSubdivisions.clear();
+      m_lodSubdivisionsValid = false;
+    }
+  }
+}
+
 void PatchRenderer::prepareVerticesAndIndices(VboManager& vboManager)
 {
-  m_patchMeshRenderer.prepare(vboManager);
+  if (m_renderLodMesh)
+  {
+    for (auto& lodMesh : m_lodMeshes)
+    {
+      lodMesh.renderer.prepare(vboManager);
+    }
+  }
+  else
+  {
+    m_patchMeshRenderer.prepare(vboManager);
+  }
 }
 
 namespace
@@ -415,7 +547,17 @@ void PatchRenderer::doRender(RenderContext& context)
   }
   */
 
-  m_patchMeshRenderer.render(func);
+  if (m_renderLodMesh)
+  {
+    for (auto& lodMesh : m_lodMeshes)
+    {
+      lodMesh.renderer.render(func);
+    }
+  }
+  else
+  {
+    m_patchMeshRenderer.render(func);
+  }
 
   /*
   if (m_alpha < 1.0f) {
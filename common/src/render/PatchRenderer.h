@@ -26,6 +26,10 @@
 
 #include "kdl/vector_set.h"
 
+#include "vm/vec.h"
+
+#include <vector>
+
 namespace tb::mdl
 {
 class EditorContext;
@@ -45,8 +49,34 @@ private:
 
   bool m_valid = true;
   kdl::vector_set<const mdl::PatchNode*> m_patchNodes;
+  std::vector<const mdl::PatchNode*> m_visiblePatchNodes;
 
+  // full detail mesh, used for orthographic views
+  bool m_meshValid = false;
   MaterialIndexArrayRenderer m_patchMeshRenderer;
+
+  // level of detail meshes, used for perspective views
+  struct LodMesh
+  {
+    bool valid = false;
+    MaterialIndexArrayRenderer renderer;
+  };
+
+  // the number of subdivisions selected for each visible patch
+  bool m_lodSubdivisionsValid = false;
+  std::vector<size_t> m_lodSubdivisions;
+
+  // one mesh per number of subdivisions, so that a patch that switches to another number
+  // of subdivisions only requires rebuilding two meshes
+  std::vector<LodMesh> m_lodMeshes;
+
+  bool m_renderLodMesh = false;
+
+  // the number of consecutive renders that did not use the full detail mesh or the level
+  // of detail meshes, respectively
+  size_t m_rendersWithoutMesh = 0;
+  size_t m_rendersWithoutLodMeshes = 0;
+
   DirectEdgeRenderer m_edgeRenderer;
 
   Color m_defaultColor;
@@ -117,6 +147,9 @@ public:
 
 private:
   void validate();
+  void validateMesh();
+  void validateLodMeshes(const vm::vec3d& viewPosition);
+  void releaseUnusedMeshes();
 
 private: // implement IndexedRenderable interface
   void prepareVerticesAndIndices(VboManager& vboManager) override;
@@ -20,6 +20,7 @@
 #include "PrimitiveRenderer.h"
 
 #include "Color.h"
+#include "Macros.h"
 #include "render/ActiveShader.h"
 #include "render/RenderContext.h"
 #include "render/RenderUtils.h"
@@ -209,6 +210,11 @@ void PrimitiveRenderer::TriangleRenderAttributes::render(
   }
 }
 
+PrimitiveRenderer::PrimitiveRenderer(const PrimitiveRendererUploadPolicy uploadPolicy)
+  : m_uploadPolicy{uploadPolicy}
+{
+}
+
 void PrimitiveRenderer::renderLine(
   const Color& color,
   const float lineWidth,
@@ -367,7 +373,7 @@ void PrimitiveRenderer::prepareLines(VboManager& vboManager)
   {
     auto& renderer =
       m_lineMeshRenderers.emplace(attributes, IndexRangeRenderer{mesh}).first->second;
-    renderer.prepare(vboManager);
+    prepare(renderer, vboManager);
   }
 }
 
@@ -377,7 +383,21 @@ void PrimitiveRenderer::prepareTriangles(VboManager& vboManager)
   {
     auto& renderer =
       m_triangleMeshRenderers.emplace(attributes, IndexRangeRenderer{mesh}).first->second;
+    prepare(renderer, vboManager);
+  }
+}
+
+void PrimitiveRenderer::prepare(IndexRangeRenderer& renderer, VboManager& vboManager)
+{
+  switch (m_uploadPolicy)
+  {
+  case PrimitiveRendererUploadPolicy::Upload:
     renderer.prepare(vboManager);
+    break;
+  case PrimitiveRendererUploadPolicy::Stream:
+    renderer.stream(vboManager);
+    break;
+    switchDefault();
   }
 }
 
@@ -49,12 +49,24 @@ enum class PrimitiveRendererCullingPolicy
   ShowBackfaces
 };
 
+/**
+ * Controls how the vertices of a primitive renderer are uploaded. Use Stream only for
+ * renderers that are rendered once, see VertexArray::stream.
+ */
+enum class PrimitiveRendererUploadPolicy
+{
+  Upload,
+  Stream
+};
+
 class PrimitiveRenderer : public DirectRenderable
 {
 public:
 private:
   using Vertex = GLVertexTypes::P3::Vertex;
 
+  PrimitiveRendererUploadPolicy m_uploadPolicy;
+
   class LineRenderAttributes
   {
   private:
@@ -103,6 +115,9 @@ private:
   TriangleMeshRendererMap m_triangleMeshRenderers;
 
 public:
+  explicit PrimitiveRenderer(
+    PrimitiveRendererUploadPolicy uploadPolicy = PrimitiveRendererUploadPolicy::Upload);
+
   void renderLine(
     const Color& color,
     float lineWidth,
@@ -170,6 +185,7 @@ private:
   void doPrepareVertices(VboManager& vboManager) override;
   void prepareLines(VboManager& vboManager);
   void prepareTriangles(VboManager& vboManager);
+  void prepare(IndexRangeRenderer& renderer, VboManager& vboManager);
 
   void doRender(RenderContext& renderContext) override;
   void renderLines(RenderContext& renderContext);
@@ -108,7 +108,9 @@ void RenderBatch::addOneShot(IndexedRenderable* renderable)
 void RenderBatch::render(RenderContext& renderContext)
 {
   prepareRenderables();
+  m_vboManager.flushStream();
   renderRenderables(renderContext);
+  m_vboManager.endStreamFrame();
 }
 
 void RenderBatch::doAdd(Renderable* renderable)
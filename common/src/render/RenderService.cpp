@@ -79,7 +79,8 @@ RenderService::RenderService(RenderContext& renderContext, RenderBatch& renderBa
   , m_renderBatch{renderBatch}
   , m_textRenderer{std::make_unique<TextRenderer>(makeRenderServiceFont())}
   , m_pointHandleRenderer{std::make_unique<PointHandleRenderer>()}
-  , m_primitiveRenderer{std::make_unique<PrimitiveRenderer>()}
+  , m_primitiveRenderer{std::make_unique<PrimitiveRenderer>(
+      PrimitiveRendererUploadPolicy::Stream)}
   , m_occlusionPolicy{OcclusionPolicy::Transparent}
   , m_cullingPolicy{CullingPolicy::CullBackfaces}
 {
@@ -0,0 +1,116 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RingAllocationTracker.h"
+
+#include "Ensure.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace tb::render
+{
+
+RingAllocationTracker::RingAllocationTracker(const Index capacity)
+  : m_capacity{capacity}
+{
+}
+
+std::optional<RingAllocationTracker::Index> RingAllocationTracker::allocate(
+  const Index size, const Index alignment)
+{
+  ensure(size > 0, "allocation must not be empty");
+  ensure(alignment > 0, "alignment must be positive");
+
+  if (m_usedSize == 0)
+  {
+    // nothing is in use, so we can start over at the beginning of the buffer
+    m_head = 0;
+  }
+
+  auto pos = (m_head + alignment - 1) / alignment * alignment;
+  if (pos > m_capacity || size > m_capacity - pos)
+  {
+    // wrap around, the remainder of the buffer is wasted until this frame is retired
+    pos = 0;
+  }
+
+  const auto padding = pos >= m_head ? pos - m_head : m_capacity - m_head;
+  if (size > m_capacity || padding + size > m_capacity - m_usedSize)
+  {
+    return std::nullopt;
+  }
+
+  m_head = pos + size;
+  m_usedSize += padding + size;
+  m_currentFrameSize += padding + size;
+  m_peakUsedSize = std::max(m_peakUsedSize, m_usedSize);
+
+  return pos;
+}
+
+void RingAllocationTracker::endFrame()
+{
+  m_frameSizes.push_back(m_currentFrameSize);
+  m_currentFrameSize = 0;
+}
+
+void RingAllocationTracker::retireFrame()
+{
+  ensure(!m_frameSizes.empty(), "must have a frame in flight");
+
+  assert(m_frameSizes.front() <= m_usedSize);
+  m_usedSize -= m_frameSizes.front();
+  m_frameSizes.pop_front();
+}
+
+void RingAllocationTracker::reset()
+{
+  m_head = 0;
+  m_usedSize = 0;
+  m_currentFrameSize = 0;
+  m_frameSizes.clear();
+}
+
+RingAllocationTracker::Index RingAllocationTracker::capacity() const
+{
+  return m_capacity;
+}
+
+size_t RingAllocationTracker::framesInFlight() const
+{
+  return m_frameSizes.size();
+}
+
+RingAllocationTracker::Index RingAllocationTracker::usedSize() const
+{
+  return m_usedSize;
+}
+
+RingAllocationTracker::Index RingAllocationTracker::peakUsedSize() const
+{
+  return m_peakUsedSize;
+}
+
+RingAllocationTracker::Index RingAllocationTracker::currentFrameSize() const
+{
+  return m_currentFrameSize;
+}
+
+} // namespace tb::render
@@ -0,0 +1,98 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+
+namespace tb::render
+{
+
+/**
+ * Implements bookkeeping for a ring buffer that is filled with data for one frame at a
+ * time.
+ *
+ * Allocations are made sequentially and always belong to the current frame. Once a frame
+ * is ended, its allocations stay in use until the frame is retired, e.g. because the GPU
+ * has signaled that it has finished reading the data. Frames are retired in the order in
+ * which they were ended.
+ */
+class RingAllocationTracker
+{
+public:
+  using Index = size_t;
+
+private:
+  Index m_capacity;
+
+  /**
+   * The position at which the next allocation is attempted.
+   */
+  Index m_head = 0;
+
+  /**
+   * The number of bytes used by the current frame and all frames in flight, including
+   * any padding.
+   */
+  Index m_usedSize = 0;
+  Index m_peakUsedSize = 0;
+
+  Index m_currentFrameSize = 0;
+  std::deque<Index> m_frameSizes;
+
+public:
+  explicit RingAllocationTracker(Index capacity);
+
+  /**
+   * Tries to allocate a range of the given size whose position is a multiple of the
+   * given alignment. Allocations never wrap around the end of the buffer.
+   *
+   * @return the position of the allocated range or an empty optional if there is no room
+   * for the requested allocation
+   */
+  std::optional<Index> allocate(Index size, Index alignment = 1);
+
+  /**
+   * Ends the current frame. Its allocations remain in use until it is retired.
+   */
+  void endFrame();
+
+  /**
+   * Releases the allocations of the oldest frame in flight.
+   *
+   * Precondition: framesInFlight() > 0
+   */
+  void retireFrame();
+
+  /**
+   * Releases all allocations, including the ones made for the current frame.
+   */
+  void reset();
+
+  Index capacity() const;
+  size_t framesInFlight() const;
+
+  Index usedSize() const;
+  Index peakUsedSize() const;
+  Index currentFrameSize() const;
+};
+
+} // namespace tb::render
@@ -211,8 +211,8 @@ void TextRenderer::prepare(
   collection.textArray = VertexArray::move(std::move(textVertices));
   collection.rectArray = VertexArray::move(std::move(rectVertices));
 
-  collection.textArray.prepare(vboManager);
-  collection.rectArray.prepare(vboManager);
+  collection.textArray.stream(vboManager);
+  collection.rectArray.stream(vboManager);
 }
 
 void TextRenderer::addEntry(
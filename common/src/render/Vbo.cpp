@@ -27,12 +27,13 @@ namespace tb::render
 Vbo::Vbo(const GLenum type, const size_t capacity, const GLenum usage)
   : m_type{type}
   , m_capacity{capacity}
+  , m_usage{usage}
 {
   assert(m_type == GL_ELEMENT_ARRAY_BUFFER || m_type == GL_ARRAY_BUFFER);
 
   glAssert(glGenBuffers(1, &m_bufferId));
   glAssert(glBindBuffer(m_type, m_bufferId));
-  glAssert(glBufferData(m_type, static_cast<GLsizeiptr>(m_capacity), nullptr, usage));
+  glAssert(glBufferData(m_type, static_cast<GLsizeiptr>(m_capacity), nullptr, m_usage));
 }
 
 void Vbo::free()
@@ -42,6 +43,13 @@ void Vbo::free()
   m_bufferId = 0;
 }
 
+void Vbo::orphan()
+{
+  assert(m_bufferId != 0);
+  glAssert(glBindBuffer(m_type, m_bufferId));
+  glAssert(glBufferData(m_type, static_cast<GLsizeiptr>(m_capacity), nullptr, m_usage));
+}
+
 Vbo::~Vbo()
 {
   assert(m_bufferId == 0);
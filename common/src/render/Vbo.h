@@ -42,6 +42,7 @@ private:
    */
   GLenum m_type;
   size_t m_capacity;
+  GLenum m_usage;
   GLuint m_bufferId;
 
 public:
@@ -59,6 +60,13 @@ public:
    */
   void free();
 
+  /**
+   * Replaces the storage of the underlying OpenGL buffer with new storage of the same
+   * capacity. The previous storage is kept alive by the driver until pending draw calls
+   * have finished reading from it. The contents are unspecified afterwards.
+   */
+  void orphan();
+
   /**
    * Deprecated, always returns 0.
    */
@@ -24,6 +24,8 @@
 #include "Vbo.h"
 
 #include <algorithm>
+#include <cassert>
+#include <cstring>
 #include <memory>
 
 namespace tb::render
@@ -52,17 +54,40 @@ static GLenum usageToOpenGL(const VboUsage usage)
     return GL_STATIC_DRAW;
   case VboUsage::DynamicDraw:
     return GL_DYNAMIC_DRAW;
+  case VboUsage::StreamDraw:
+    return GL_STREAM_DRAW;
     switchDefault();
   }
 }
 
+constexpr auto StreamCapacity = size_t(4 * 1024 * 1024);
+constexpr auto StreamAlignment = size_t(16);
+constexpr auto StreamFenceTimeout = GLuint64(1000000000); // one second
+
 // VboManager
 
 VboManager::VboManager(ShaderManager& shaderManager)
   : m_shaderManager{shaderManager}
+  , m_streamTracker{StreamCapacity}
 {
 }
 
+VboManager::~VboManager()
+{
+  for (auto fence : m_streamFences)
+  {
+    if (fence != nullptr)
+    {
+      glAssert(glDeleteSync(fence));
+    }
+  }
+
+  if (m_streamVbo)
+  {
+    destroyVbo(m_streamVbo);
+  }
+}
+
 Vbo* VboManager::allocateVbo(VboType type, const size_t capacity, const VboUsage usage)
 {
   auto result = std::make_unique<Vbo>(typeToOpenGL(type), capacity, usageToOpenGL(usage));
@@ -83,6 +108,38 @@ void VboManager::destroyVbo(Vbo* vbo)
   delete vbo;
 }
 
+void VboManager::flushStream()
+{
+  m_streamUploadCount = 0;
+
+  for (size_t i = m_flushedStreamRangeCount; i < m_streamRanges.size(); ++i)
+  {
+    const auto [begin, end] = m_streamRanges[i];
+    m_streamVbo->writeArray(begin, m_streamData.data() + begin, end - begin);
+    ++m_streamUploadCount;
+  }
+  m_flushedStreamRangeCount = m_streamRanges.size();
+
+  m_peakStreamUploadCount = std::max(m_peakStreamUploadCount, m_streamUploadCount);
+}
+
+void VboManager::endStreamFrame()
+{
+  if (m_streamTracker.currentFrameSize() == 0)
+  {
+    return;
+  }
+
+  assert(m_flushedStreamRangeCount == m_streamRanges.size());
+
+  m_streamTracker.endFrame();
+  m_streamFences.push_back(
+    GLEW_ARB_sync ? glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) : nullptr);
+
+  m_streamRanges.clear();
+  m_flushedStreamRangeCount = 0;
+}
+
 size_t VboManager::peakVboCount() const
 {
   return m_peakVboCount;
@@ -98,9 +155,134 @@ size_t VboManager::currentVboSize() const
   return m_currentVboSize;
 }
 
+size_t VboManager::streamCapacity() const
+{
+  return m_streamTracker.capacity();
+}
+
+size_t VboManager::currentStreamSize() const
+{
+  return m_streamTracker.usedSize();
+}
+
+size_t VboManager::peakStreamSize() const
+{
+  return m_streamTracker.peakUsedSize();
+}
+
+size_t VboManager::streamUploadCount() const
+{
+  return m_streamUploadCount;
+}
+
+size_t VboManager::peakStreamUploadCount() const
+{
+  return m_peakStreamUploadCount;
+}
+
 ShaderManager& VboManager::shaderManager()
 {
   return m_shaderManager;
 }
 
+std::optional<VboStreamBlock> VboManager::streamData(const void* data, const size_t size)
+{
+  if (size == 0 || size > StreamCapacity)
+  {
+    return std::nullopt;
+  }
+
+  if (!m_streamVbo)
+  {
+    m_streamVbo = allocateVbo(VboType::ArrayBuffer, StreamCapacity, VboUsage::StreamDraw);
+    m_streamData.resize(StreamCapacity);
+  }
+
+  const auto offset = allocateStreamRange(size);
+  if (!offset)
+  {
+    return std::nullopt;
+  }
+
+  std::memcpy(m_streamData.data() + *offset, data, size);
+
+  // coalesce with the previous range if only alignment padding lies between them
+  if (
+    m_streamRanges.size() > m_flushedStreamRangeCount
+    && m_streamRanges.back().second <= *offset
+    && *offset - m_streamRanges.back().second < StreamAlignment)
+  {
+    m_streamRanges.back().second = *offset + size;
+  }
+  else
+  {
+    m_streamRanges.emplace_back(*offset, *offset + size);
+  }
+
+  return VboStreamBlock{m_streamVbo, *offset};
+}
+
+std::optional<size_t> VboManager::allocateStreamRange(const size_t size)
+{
+  retireStreamFrames(false);
+  if (const auto offset = m_streamTracker.allocate(size, StreamAlignment))
+  {
+    return offset;
+  }
+
+  if (m_streamTracker.framesInFlight() > 0)
+  {
+    retireStreamFrames(true);
+    return m_streamTracker.allocate(size, StreamAlignment);
+  }
+
+  return std::nullopt;
+}
+
+void VboManager::retireStreamFrames(bool wait)
+{
+  while (!m_streamFences.empty())
+  {
+    auto fence = m_streamFences.front();
+    if (fence == nullptr)
+    {
+      if (!wait)
+      {
+        return;
+      }
+
+      // Without sync objects, we cannot tell when the GPU is done with a frame. Instead,
+      // we orphan the buffer storage and retire all frames. The ranges written in the
+      // current frame must be uploaded again.
+      m_streamVbo->orphan();
+      while (!m_streamFences.empty())
+      {
+        if (m_streamFences.front() != nullptr)
+        {
+          glAssert(glDeleteSync(m_streamFences.front()));
+        }
+        m_streamFences.pop_front();
+        m_streamTracker.retireFrame();
+      }
+      m_flushedStreamRangeCount = 0;
+      return;
+    }
+
+    const auto flags = wait ? GLbitfield(GL_SYNC_FLUSH_COMMANDS_BIT) : GLbitfield(0);
+    const auto timeout = wait ? StreamFenceTimeout : GLuint64(0);
+    const auto result = glClientWaitSync(fence, flags, timeout);
+    if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+    {
+      return;
+    }
+
+    glAssert(glDeleteSync(fence));
+    m_streamFences.pop_front();
+    m_streamTracker.retireFrame();
+
+    // only wait for the oldest frame
+    wait = false;
+  }
+}
+
 } // namespace tb::render
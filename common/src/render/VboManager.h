@@ -19,7 +19,14 @@
 
 #pragma once
 
+#include "render/GL.h"
+#include "render/RingAllocationTracker.h"
+
 #include <cstddef>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace tb::render
 {
@@ -35,7 +42,17 @@ enum class VboType
 enum class VboUsage
 {
   StaticDraw,
-  DynamicDraw
+  DynamicDraw,
+  StreamDraw
+};
+
+/**
+ * A range of the stream buffer, see VboManager::streamArray.
+ */
+struct VboStreamBlock
+{
+  Vbo* vbo;
+  size_t offset;
 };
 
 class VboManager
@@ -46,8 +63,37 @@ private:
   size_t m_currentVboSize = 0;
   ShaderManager& m_shaderManager;
 
+  /**
+   * A ring buffer for vertices that are only rendered once. The buffer is created when it
+   * is first used.
+   */
+  Vbo* m_streamVbo = nullptr;
+  RingAllocationTracker m_streamTracker;
+
+  /**
+   * A copy of the stream buffer contents. Data written to the stream buffer is collected
+   * here and uploaded in as few calls as possible when the stream is flushed.
+   */
+  std::vector<unsigned char> m_streamData;
+
+  /**
+   * The ranges of m_streamData written in the current frame. The ranges starting at
+   * m_flushedStreamRangeCount have not been uploaded yet.
+   */
+  std::vector<std::pair<size_t, size_t>> m_streamRanges;
+  size_t m_flushedStreamRangeCount = 0;
+
+  /**
+   * One fence per frame in flight, or null if sync objects are not supported.
+   */
+  std::deque<GLsync> m_streamFences;
+
+  size_t m_streamUploadCount = 0;
+  size_t m_peakStreamUploadCount = 0;
+
 public:
   explicit VboManager(ShaderManager& shaderManager);
+  ~VboManager();
   /**
    * Immediately creates and binds to an OpenGL buffer of the given type and capacity.
    * The contents are initially unspecified. See Vbo class.
@@ -55,11 +101,53 @@ public:
   Vbo* allocateVbo(VboType type, size_t capacity, VboUsage usage = VboUsage::StaticDraw);
   void destroyVbo(Vbo* vbo);
 
+  /**
+   * Writes the given elements to the stream buffer. The data is uploaded when the stream
+   * is flushed and remains valid until the end of the current frame, so this is only
+   * suitable for vertices that are rendered once.
+   *
+   * @return the stream buffer and the byte offset at which the elements were written, or
+   * an empty optional if the elements do not fit into the stream buffer
+   */
+  template <typename T>
+  std::optional<VboStreamBlock> streamArray(const T* array, const size_t count)
+  {
+    return streamData(array, count * sizeof(T));
+  }
+
+  /**
+   * Uploads all data that was written to the stream buffer since the last flush. Must be
+   * called before the streamed data is rendered.
+   */
+  void flushStream();
+
+  /**
+   * Ends the current frame. The stream buffer ranges written in this frame are reused
+   * once the GPU has finished rendering the frame.
+   */
+  void endStreamFrame();
+
   size_t peakVboCount() const;
   size_t currentVboCount() const;
   size_t currentVboSize() const;
 
+  size_t streamCapacity() const;
+  size_t currentStreamSize() const;
+  size_t peakStreamSize() const;
+
+  /**
+   * The number of buffer uploads made when the stream was last flushed, and the maximum
+   * thereof.
+   */
+  size_t streamUploadCount() const;
+  size_t peakStreamUploadCount() const;
+
   ShaderManager& shaderManager();
+
+private:
+  std::optional<VboStreamBlock> streamData(const void* data, size_t size);
+  std::optional<size_t> allocateStreamRange(size_t size);
+  void retireStreamFrames(bool wait);
 };
 
 } // namespace tb::render
@@ -54,12 +54,26 @@ void VertexArray::prepare(VboManager& vboManager)
 {
   if (!prepared() && !empty())
   {
-    m_holder->prepare(vboManager);
+    m_holder->prepare(vboManager, false);
+  }
+  m_prepared = true;
+}
+
+void VertexArray::stream(VboManager& vboManager)
+{
+  if (!prepared() && !empty())
+  {
+    m_holder->prepare(vboManager, true);
   }
   m_prepared = true;
 }
 
 bool VertexArray::setup()
+{
+  return setup(0);
+}
+
+bool VertexArray::setup(const size_t firstVertex)
 {
   if (empty())
   {
@@ -69,7 +83,7 @@ bool VertexArray::setup()
   assert(prepared());
   assert(!m_setup);
 
-  m_holder->setup();
+  m_holder->setup(firstVertex);
   m_setup = true;
   return true;
 }
@@ -149,6 +163,27 @@ void VertexArray::render(
   }
 }
 
+void VertexArray::renderInstanced(
+  const PrimType primType,
+  const GLint index,
+  const GLsizei count,
+  const GLsizei instanceCount)
+{
+  assert(prepared());
+  if (!m_setup)
+  {
+    if (setup())
+    {
+      glAssert(glDrawArraysInstancedARB(toGL(primType), index, count, instanceCount));
+      cleanup();
+    }
+  }
+  else
+  {
+    glAssert(glDrawArraysInstancedARB(toGL(primType), index, count, instanceCount));
+  }
+}
+
 VertexArray::VertexArray(std::shared_ptr<BaseHolder> holder)
   : m_holder{std::move(holder)}
 {
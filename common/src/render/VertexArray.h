@@ -55,8 +55,8 @@ private:
     virtual size_t vertexCount() const = 0;
     virtual size_t sizeInBytes() const = 0;
 
-    virtual void prepare(VboManager& vboManager) = 0;
-    virtual void setup() = 0;
+    virtual void prepare(VboManager& vboManager, bool stream) = 0;
+    virtual void setup(size_t firstVertex) = 0;
     virtual void cleanup() = 0;
   };
 
@@ -66,6 +66,8 @@ private:
   private:
     VboManager* m_vboManager = nullptr;
     Vbo* m_vbo = nullptr;
+    size_t m_offset = 0;
+    bool m_streamed = false;
     size_t m_vertexCount = 0;
 
   public:
@@ -73,21 +75,36 @@ private:
 
     size_t sizeInBytes() const override { return VertexSpec::Size * m_vertexCount; }
 
-    void prepare(VboManager& vboManager) override
+    void prepare(VboManager& vboManager, const bool stream) override
     {
       if (m_vertexCount > 0 && m_vbo == nullptr)
       {
         m_vboManager = &vboManager;
+
+        const auto& vertices = doGetVertices();
+        if (stream)
+        {
+          if (const auto block = vboManager.streamArray(vertices.data(), vertices.size()))
+          {
+            m_vbo = block->vbo;
+            m_offset = block->offset;
+            m_streamed = true;
+            return;
+          }
+        }
+
         m_vbo = vboManager.allocateVbo(VboType::ArrayBuffer, sizeInBytes());
-        m_vbo->writeBuffer(0, doGetVertices());
+        m_vbo->writeBuffer(0, vertices);
       }
     }
 
-    void setup() override
+    void setup(const size_t firstVertex) override
     {
       ensure(m_vbo, "block is null");
       m_vbo->bind();
-      VertexSpec::setup(m_vboManager->shaderManager().currentProgram(), m_vbo->offset());
+      VertexSpec::setup(
+        m_vboManager->shaderManager().currentProgram(),
+        m_vbo->offset() + m_offset + firstVertex * VertexSpec::Size);
     }
 
     void cleanup() override
@@ -106,7 +123,7 @@ private:
     {
       // TODO: Revisit this revisiting OpenGL resource management. We should not store the
       // VboManager, since it represents a safe time to delete the OpenGL buffer object.
-      if (m_vbo)
+      if (m_vbo && !m_streamed)
       {
         m_vboManager->destroyVbo(m_vbo);
         m_vbo = nullptr;
@@ -140,9 +157,9 @@ private:
     {
     }
 
-    void prepare(VboManager& vboManager) override
+    void prepare(VboManager& vboManager, const bool stream) override
     {
-      Holder<VertexSpec>::prepare(vboManager);
+      Holder<VertexSpec>::prepare(vboManager, stream);
       kdl::vec_clear_to_zero(m_vertices);
     }
 
@@ -268,6 +285,18 @@ public:
    */
   void prepare(VboManager& vboManager);
 
+  /**
+   * Prepares this vertex array by writing its contents into the stream buffer of the
+   * given VBO manager. Streamed vertices share a single buffer and are uploaded together
+   * when the render batch is rendered, but they are only valid for the current frame.
+   * Only use this for vertex arrays that are rendered once. If the stream buffer is full,
+   * this falls back to uploading the contents into a separate vertex buffer object.
+   *
+   * @param vboManager the VBO manager to whose stream buffer the contents of this vertex
+   * array are written
+   */
+  void stream(VboManager& vboManager);
+
   /**
    * Sets this vertex array up for rendering. If this vertex array is only rendered once,
    * then there is no need to call this method (or the corresponding cleanup method),
@@ -283,6 +312,17 @@ public:
    */
   bool setup();
 
+  /**
+   * Sets this vertex array up for rendering such that the vertex with the given index
+   * becomes the first vertex. This is useful for arrays of per instance attributes where
+   * each render call uses a different sub range of the array.
+   *
+   * The same rules as for setup() apply regarding cleanup.
+   *
+   * @param firstVertex the index of the vertex to start at
+   */
+  bool setup(size_t firstVertex);
+
   /**
    * Renders this vertex array as a range of primitives of the given type.
    *
@@ -322,6 +362,22 @@ public:
    * @param count the number of vertices to render
    */
   void render(PrimType primType, const GLIndices& indices, GLsizei count);
+
+  /**
+   * Renders the given number of instances of a sub range of this vertex array as a range
+   * of primitives of the given type. Per instance attributes must have been set up by the
+   * caller before calling this method.
+   *
+   * Requires support for GL_ARB_draw_instanced.
+   *
+   * @param primType the primitive type to render
+   * @param index the index of the first vertex in this vertex array to render
+   * @param count the number of vertices to render
+   * @param instanceCount the number of instances to render
+   */
+  void renderInstanced(
+    PrimType primType, GLint index, GLsizei count, GLsizei instanceCount);
+
   void cleanup();
 
 private:
@@ -22,6 +22,7 @@
 #include "Ensure.h"
 #include "Macros.h"
 #include "mdl/Node.h"
+#include "mdl/NodeContents.h"
 #include "ui/MapDocumentCommandFacade.h"
 
 #include "kdl/map_utils.h"
@@ -73,6 +74,21 @@ AddRemoveNodesCommand::AddRemoveNodesCommand(
   }
 }
 
+size_t AddRemoveNodesCommand::memoryUsage() const
+{
+  // The nodes to add are owned by this command, e.g. the nodes that were removed when
+  // this command was done. The nodes to remove are owned by the document.
+  auto result = UpdateLinkedGroupsCommandBase::memoryUsage();
+  for (const auto& [parent, children] : m_nodesToAdd)
+  {
+    for (const auto* child : children)
+    {
+      result += mdl::memoryUsage(*child);
+    }
+  }
+  return result;
+}
+
 std::string AddRemoveNodesCommand::makeName(const Action action)
 {
   switch (action)
@@ -31,6 +31,8 @@
 #include "kdl/vector_utils.h"
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
 
 namespace tb::ui
 {
@@ -104,6 +106,16 @@ private:
     return std::make_unique<CommandResult>(true);
   }
 
+  size_t memoryUsage() const override
+  {
+    auto result = UndoableCommand::memoryUsage();
+    for (const auto& command : m_commands)
+    {
+      result += command->memoryUsage();
+    }
+    return result;
+  }
+
   bool doCollateWith(UndoableCommand& other) override
   {
     if (auto* transactionCommand = dynamic_cast<TransactionCommand*>(&other))
@@ -165,6 +177,7 @@ CommandProcessor::CommandProcessor(
   MapDocumentCommandFacade& document, const std::chrono::milliseconds collationInterval)
   : m_document{document}
   , m_collationInterval{collationInterval}
+  , m_undoMemoryBudget{std::numeric_limits<size_t>::max()}
   , m_lastCommandTimestamp{std::chrono::time_point<std::chrono::system_clock>{}}
 {
 }
@@ -181,6 +194,25 @@ bool CommandProcessor::canRedo() const
   return m_transactionStack.empty() && !m_redoStack.empty();
 }
 
+size_t CommandProcessor::undoMemoryUsage() const
+{
+  return m_totalUndoStackMemoryUsage;
+}
+
+size_t CommandProcessor::undoMemoryBudget() const
+{
+  return m_undoMemoryBudget;
+}
+
+void CommandProcessor::setUndoMemoryBudget(const size_t undoMemoryBudget)
+{
+  m_undoMemoryBudget = undoMemoryBudget;
+  if (m_transactionStack.empty())
+  {
+    enforceUndoMemoryBudget();
+  }
+}
+
 const std::string& CommandProcessor::undoCommandName() const
 {
   if (!canUndo())
@@ -245,7 +277,7 @@ std::unique_ptr<CommandResult> CommandProcessor::execute(std::unique_ptr<Command
   auto result = executeCommand(*command);
   if (result->success())
   {
-    m_undoStack.clear();
+    clearUndoStack();
     m_redoStack.clear();
   }
   return result;
@@ -303,7 +335,7 @@ void CommandProcessor::clear()
 {
   assert(m_transactionStack.empty());
 
-  m_undoStack.clear();
+  clearUndoStack();
   m_redoStack.clear();
   m_lastCommandTimestamp = std::chrono::time_point<std::chrono::system_clock>();
 }
@@ -437,11 +469,23 @@ bool CommandProcessor::pushToUndoStack(
     auto& lastCommand = m_undoStack.back();
     if (lastCommand->collateWith(*command))
     {
+      // the collated command may hold more memory now
+      auto& lastMemoryUsage = m_undoStackMemoryUsage.back();
+      m_totalUndoStackMemoryUsage -= lastMemoryUsage;
+      lastMemoryUsage = lastCommand->memoryUsage();
+      m_totalUndoStackMemoryUsage += lastMemoryUsage;
+
+      enforceUndoMemoryBudget();
       return false;
     }
   }
 
+  const auto memoryUsage = command->memoryUsage();
   m_undoStack.push_back(std::move(command));
+  m_undoStackMemoryUsage.push_back(memoryUsage);
+  m_totalUndoStackMemoryUsage += memoryUsage;
+
+  enforceUndoMemoryBudget();
   return true;
 }
 
@@ -450,6 +494,7 @@ std::unique_ptr<UndoableCommand> CommandProcessor::popFromUndoStack()
   assert(m_transactionStack.empty());
   assert(!m_undoStack.empty());
 
+  m_totalUndoStackMemoryUsage -= kdl::vec_pop_back(m_undoStackMemoryUsage);
   return kdl::vec_pop_back(m_undoStack);
 }
 
@@ -460,6 +505,35 @@ bool CommandProcessor::collatable(
          && timestamp - m_lastCommandTimestamp <= m_collationInterval;
 }
 
+void CommandProcessor::enforceUndoMemoryBudget()
+{
+  assert(m_transactionStack.empty());
+
+  auto count = size_t(0);
+  while (count + 1 < m_undoStack.size()
+         && m_totalUndoStackMemoryUsage > m_undoMemoryBudget)
+  {
+    m_totalUndoStackMemoryUsage -= m_undoStackMemoryUsage[count];
+    ++count;
+  }
+
+  if (count > 0)
+  {
+    const auto commandCount = static_cast<std::ptrdiff_t>(count);
+    m_undoStack.erase(m_undoStack.begin(), std::next(m_undoStack.begin(), commandCount));
+    m_undoStackMemoryUsage.erase(
+      m_undoStackMemoryUsage.begin(),
+      std::next(m_undoStackMemoryUsage.begin(), commandCount));
+  }
+}
+
+void CommandProcessor::clearUndoStack()
+{
+  m_undoStack.clear();
+  m_undoStackMemoryUsage.clear();
+  m_totalUndoStackMemoryUsage = 0;
+}
+
 void CommandProcessor::pushToRedoStack(std::unique_ptr<UndoableCommand> command)
 {
   assert(m_transactionStack.empty());
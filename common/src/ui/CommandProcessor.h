@@ -51,6 +51,11 @@ enum class TransactionScope;
  * The command processor supports nested transactions. Each transaction can be committed
  * or rolled back individually. Committing a nested transaction adds it as a command to
  * the containing transaction.
+ *
+ * The memory held by the commands on the undo stack can be limited by an undo memory
+ * budget. If the approximate memory usage of the undo stack exceeds the budget, the
+ * oldest commands are discarded until it fits, but the most recent command is always
+ * kept.
  */
 class CommandProcessor
 {
@@ -71,6 +76,21 @@ private:
    */
   std::vector<std::unique_ptr<UndoableCommand>> m_undoStack;
 
+  /**
+   * The approximate memory usage of each command on the undo stack, in the same order.
+   */
+  std::vector<size_t> m_undoStackMemoryUsage;
+
+  /**
+   * The sum of the values in m_undoStackMemoryUsage.
+   */
+  size_t m_totalUndoStackMemoryUsage = 0;
+
+  /**
+   * The maximum approximate memory usage of the undo stack in bytes.
+   */
+  size_t m_undoMemoryBudget;
+
   /**
    * Holds the commands that were undone, with the most recently undone command at the
    * beginning of the vector.
@@ -153,6 +173,22 @@ public:
    */
   bool canRedo() const;
 
+  /**
+   * Returns the approximate memory usage of the commands on the undo stack in bytes.
+   */
+  size_t undoMemoryUsage() const;
+
+  /**
+   * Returns the maximum approximate memory usage of the undo stack in bytes.
+   */
+  size_t undoMemoryBudget() const;
+
+  /**
+   * Sets the maximum approximate memory usage of the undo stack in bytes and discards the
+   * oldest commands on the undo stack if they exceed the new budget.
+   */
+  void setUndoMemoryBudget(size_t undoMemoryBudget);
+
   /**
    * Returns the name of the command that will be undone when calling `undo`.
    *
@@ -373,6 +409,17 @@ private:
 
   bool collatable(bool collate, std::chrono::system_clock::time_point timestamp) const;
 
+  /**
+   * Discards the oldest commands on the undo stack until the memory usage of the undo
+   * stack fits into the undo memory budget or until only one command is left.
+   */
+  void enforceUndoMemoryBudget();
+
+  /**
+   * Removes all commands from the undo stack.
+   */
+  void clearUndoStack();
+
   /**
    * Pushes the given command onto the redo stack. Takes ownership of the given command.
    *
@@ -3179,19 +3179,25 @@ bool MapDocument::csgSubtract()
   const auto subtrahends = kdl::vec_transform(
     subtrahendNodes, [](const auto* subtrahendNode) { return &subtrahendNode->brush(); });
 
+  // The minuends are independent of each other, so subtract from them in parallel.
+  // Brush::subtract skips subtrahends that don't overlap the minuend.
+  const auto mapFormat = m_world->mapFormat();
+  const auto& materialName = currentMaterialName();
+  auto subtractionResults =
+    kdl::vec_parallel_transform(minuendNodes, [&](const auto* minuendNode) {
+      return minuendNode->brush().subtract(
+        mapFormat, m_worldBounds, materialName, subtrahends);
+    });
+
   auto toAdd = std::map<mdl::Node*, std::vector<mdl::Node*>>{};
   auto toRemove =
     std::vector<mdl::Node*>{std::begin(subtrahendNodes), std::end(subtrahendNodes)};
 
   return kdl::vec_transform(
            minuendNodes,
-           [&](auto* minuendNode) {
-             const auto& minuend = minuendNode->brush();
-             auto currentSubtractionResults = minuend.subtract(
-               m_world->mapFormat(), m_worldBounds, currentMaterialName(), subtrahends);
-
+           [&](auto* minuendNode, const size_t i) {
              return kdl::vec_filter(
-                      std::move(currentSubtractionResults),
+                      std::move(subtractionResults[i]),
                       [](const auto r) { return r | kdl::is_success(); })
                     | kdl::fold | kdl::transform([&](auto currentBrushes) {
                         if (!currentBrushes.empty())
@@ -3278,38 +3284,48 @@ bool MapDocument::csgHollow()
     return false;
   }
 
+  // Hollowing is independent for each brush, so compute the fragments in parallel.
+  const auto mapFormat = m_world->mapFormat();
+  const auto& materialName = currentMaterialName();
+  const auto thickness = double(m_grid->actualSize());
+  auto hollowResults =
+    kdl::vec_parallel_transform(brushNodes, [&](const auto* brushNode) {
+      const auto& originalBrush = brushNode->brush();
+
+      auto shrunkenBrush = originalBrush;
+      return shrunkenBrush.expand(m_worldBounds, -thickness, true)
+             | kdl::transform([&]() {
+                 return originalBrush.subtract(
+                   mapFormat, m_worldBounds, materialName, shrunkenBrush);
+               });
+    });
+
   bool didHollowAnything = false;
   auto toAdd = std::map<mdl::Node*, std::vector<mdl::Node*>>{};
   auto toRemove = std::vector<mdl::Node*>{};
 
-  for (auto* brushNode : brushNodes)
-  {
-    const auto& originalBrush = brushNode->brush();
-
-    auto shrunkenBrush = originalBrush;
-    shrunkenBrush.expand(m_worldBounds, -double(m_grid->actualSize()), true)
-      | kdl::and_then([&]() {
-          didHollowAnything = true;
-
-          return originalBrush.subtract(
-                   m_world->mapFormat(),
-                   m_worldBounds,
-                   currentMaterialName(),
-                   shrunkenBrush)
-                 | kdl::fold | kdl::transform([&](auto fragments) {
-                     auto fragmentNodes =
-                       kdl::vec_transform(std::move(fragments), [](auto&& b) {
-                         return new mdl::BrushNode{std::forward<decltype(b)>(b)};
-                       });
-
-                     auto& toAddForParent = toAdd[brushNode->parent()];
-                     toAddForParent =
-                       kdl::vec_concat(std::move(toAddForParent), fragmentNodes);
-                     toRemove.push_back(brushNode);
+  for (size_t i = 0; i < brushNodes.size(); ++i)
+  {
+    auto* brushNode = brushNodes[i];
+
+    std::move(hollowResults[i]) | kdl::and_then([&](auto fragmentResults) {
+      didHollowAnything = true;
+
+      return std::move(fragmentResults) | kdl::fold
+             | kdl::transform([&](auto fragments) {
+                 auto fragmentNodes =
+                   kdl::vec_transform(std::move(fragments), [](auto&& b) {
+                     return new mdl::BrushNode{std::forward<decltype(b)>(b)};
                    });
-        })
-      | kdl::transform_error(
-        [&](const auto& e) { error() << "Could not hollow brush: " << e; });
+
+                 auto& toAddForParent = toAdd[brushNode->parent()];
+                 toAddForParent =
+                   kdl::vec_concat(std::move(toAddForParent), fragmentNodes);
+                 toRemove.push_back(brushNode);
+               });
+    }) | kdl::transform_error([&](const auto& e) {
+      error() << "Could not hollow brush: " << e;
+    });
   }
 
   if (!didHollowAnything)
@@ -4593,12 +4609,14 @@ void MapDocument::loadMaterials()
   {
     error(e.what());
   }
+  m_tagManager->invalidateMaterialTags();
 }
 
 void MapDocument::unloadMaterials()
 {
   unsetMaterials();
   m_materialManager->clear();
+  m_tagManager->invalidateMaterialTags();
 }
 
 static auto makeSetMaterialsVisitor(mdl::MaterialManager& manager)
@@ -20,6 +20,8 @@
 #include "MapDocumentCommandFacade.h"
 
 #include "Ensure.h"
+#include "PreferenceManager.h"
+#include "Preferences.h"
 #include "mdl/Brush.h"
 #include "mdl/BrushFace.h"
 #include "mdl/BrushNode.h"
@@ -46,6 +48,7 @@
 #include "kdl/vector_set.h"
 #include "kdl/vector_utils.h"
 
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -79,6 +82,7 @@ std::shared_ptr<MapDocument> MapDocumentCommandFacade::newMapDocument()
 MapDocumentCommandFacade::MapDocumentCommandFacade()
   : m_commandProcessor{std::make_unique<CommandProcessor>(*this)}
 {
+  updateUndoMemoryBudget();
   connectObservers();
 }
 
@@ -622,6 +626,26 @@ void MapDocumentCommandFacade::connectObservers()
     m_commandProcessor->transactionDoneNotifier.connect(transactionDoneNotifier);
   m_notifierConnection +=
     m_commandProcessor->transactionUndoneNotifier.connect(transactionUndoneNotifier);
+
+  auto& prefs = PreferenceManager::instance();
+  m_notifierConnection += prefs.preferenceDidChangeNotifier.connect(
+    this, &MapDocumentCommandFacade::preferenceDidChange);
+}
+
+void MapDocumentCommandFacade::preferenceDidChange(const std::filesystem::path& path)
+{
+  if (path == Preferences::UndoMemoryBudget.path())
+  {
+    updateUndoMemoryBudget();
+  }
+}
+
+void MapDocumentCommandFacade::updateUndoMemoryBudget()
+{
+  const auto undoMemoryBudget = pref(Preferences::UndoMemoryBudget);
+  m_commandProcessor->setUndoMemoryBudget(
+    undoMemoryBudget > 0 ? size_t(undoMemoryBudget) * 1024u * 1024u
+                         : std::numeric_limits<size_t>::max());
 }
 
 bool MapDocumentCommandFacade::isCurrentDocumentStateObservable() const
@@ -108,6 +108,8 @@ public: // modification count
 
 private: // notification
   void connectObservers();
+  void preferenceDidChange(const std::filesystem::path& path);
+  void updateUndoMemoryBudget();
   void documentWasNewed(MapDocument* document);
   void documentWasLoaded(MapDocument* document);
 
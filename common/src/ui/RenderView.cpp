@@ -103,13 +103,19 @@ RenderView::RenderView(GLContextManager& contextManager, QWidget* parent)
     m_maxFrameTimeMsecs = 0;
     m_lastFPSCounterUpdate = currentTime;
 
+    const auto& vboManager = m_glContext->vboManager();
     m_currentFPS = fmt::format(
-      R"(Avg FPS: {} Max time between frames: {}ms. {} currentVBOS({} peak) totalling {} KiB)",
+      R"(Avg FPS: {} Max time between frames: {}ms. {} currentVBOS({} peak) totalling {} KiB. Stream: {} KiB ({} KiB peak) of {} KiB, {} uploads ({} peak))",
       avgFps,
       maxFrameTime,
-      m_glContext->vboManager().currentVboCount(),
-      m_glContext->vboManager().peakVboCount(),
-      m_glContext->vboManager().currentVboSize() / 1024u);
+      vboManager.currentVboCount(),
+      vboManager.peakVboCount(),
+      vboManager.currentVboSize() / 1024u,
+      vboManager.currentStreamSize() / 1024u,
+      vboManager.peakStreamSize() / 1024u,
+      vboManager.streamCapacity() / 1024u,
+      vboManager.streamUploadCount(),
+      vboManager.peakStreamUploadCount());
   });
 
   fpsCounter->start(1000);
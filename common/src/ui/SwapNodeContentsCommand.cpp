@@ -68,4 +68,14 @@ bool SwapNodeContentsCommand::doCollateWith(UndoableCommand& command)
   return false;
 }
 
+size_t SwapNodeContentsCommand::memoryUsage() const
+{
+  auto result = UpdateLinkedGroupsCommandBase::memoryUsage();
+  for (const auto& [node, contents] : m_nodes)
+  {
+    result += sizeof(node) + contents.memoryUsage();
+  }
+  return result;
+}
+
 } // namespace tb::ui
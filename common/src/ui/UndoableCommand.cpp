@@ -73,6 +73,11 @@ bool UndoableCommand::collateWith(UndoableCommand& command)
   return false;
 }
 
+size_t UndoableCommand::memoryUsage() const
+{
+  return sizeof(UndoableCommand) + m_name.size();
+}
+
 bool UndoableCommand::doCollateWith(UndoableCommand&)
 {
   return false;
@@ -45,6 +45,12 @@ public:
 
   virtual bool collateWith(UndoableCommand& command);
 
+  /**
+   * Returns an approximation of the number of bytes of memory that this command holds in
+   * order to be undone or redone.
+   */
+  virtual size_t memoryUsage() const;
+
 protected:
   virtual std::unique_ptr<CommandResult> doPerformUndo(
     MapDocumentCommandFacade& document) = 0;
@@ -22,6 +22,7 @@
 #include "mdl/GroupNode.h"
 #include "mdl/LinkedGroupUtils.h"
 #include "mdl/ModelUtils.h"
+#include "mdl/NodeContents.h"
 #include "ui/MapDocumentCommandFacade.h"
 
 #include "kdl/overload.h"
@@ -47,6 +48,15 @@ auto compareByAncestry(const mdl::GroupNode* lhs, const mdl::GroupNode* rhs)
   return rhs->isAncestorOf(lhs);
 }
 
+bool containsNestedGroups(const std::vector<mdl::Node*>& groupNodes)
+{
+  return std::ranges::any_of(groupNodes, [&](const auto* groupNode) {
+    return std::ranges::any_of(groupNodes, [&](const auto* otherGroupNode) {
+      return groupNode->isAncestorOf(otherGroupNode);
+    });
+  });
+}
+
 } // namespace
 
 bool checkLinkedGroupsToUpdate(const std::vector<mdl::GroupNode*>& changedLinkedGroups)
@@ -70,19 +80,22 @@ UpdateLinkedGroupsHelper::~UpdateLinkedGroupsHelper() = default;
 Result<void> UpdateLinkedGroupsHelper::applyLinkedGroupUpdates(
   MapDocumentCommandFacade& document)
 {
-  return computeLinkedGroupUpdates(document)
-         | kdl::transform([&]() { doApplyOrUndoLinkedGroupUpdates(document); });
+  return computeLinkedGroupUpdates(document) | kdl::transform([&]() {
+           swapLinkedGroupContents(document);
+           replaceLinkedGroupChildren(document);
+         });
 }
 
 void UpdateLinkedGroupsHelper::undoLinkedGroupUpdates(MapDocumentCommandFacade& document)
 {
-  doApplyOrUndoLinkedGroupUpdates(document);
+  replaceLinkedGroupChildren(document);
+  swapLinkedGroupContents(document);
 }
 
 void UpdateLinkedGroupsHelper::collateWith(UpdateLinkedGroupsHelper& other)
 {
   // Both helpers have already applied their changes at this point, so in both helpers,
-  // m_linkedGroups contains pairs p where
+  // replacedChildren contains pairs p where
   // - p.first is the group node to update
   // - p.second is a vector containing the group node's original children
   //
@@ -93,21 +106,53 @@ void UpdateLinkedGroupsHelper::collateWith(UpdateLinkedGroupsHelper& other)
   // p_o is not an update for a linked group node that was updated by this helper, then
   // we will add p_o to our updates and remove it from the other helper's updates to
   // prevent the replaced node to be deleted with the other helper.
+  //
+  // The same applies to the contents swapped by the other helper: we keep the original
+  // contents stored in this helper and only add the contents of nodes that this helper
+  // didn't touch. If this helper replaced the children of a linked group that the other
+  // helper updated in place, the other helper's swapped contents belong to nodes that
+  // will be removed from the linked group when undoing, so they are discarded.
+  //
+  // If the other helper replaced the children of a linked group that this helper updated
+  // in place, the nodes whose contents this helper swapped are among the other helper's
+  // replaced children. Undoing restores them before swapping their contents back.
 
   auto& myLinkedGroupUpdates = std::get<LinkedGroupUpdates>(m_state);
   auto& theirLinkedGroupUpdates = std::get<LinkedGroupUpdates>(other.m_state);
 
-  for (auto& [theirGroupNodeToUpdate_, theirOldChildren] : theirLinkedGroupUpdates)
+  const auto isReplacedByMe = [&](const auto* groupNode) {
+    return std::ranges::any_of(
+      myLinkedGroupUpdates.replacedChildren,
+      [&](const auto& p) { return p.first == groupNode; });
+  };
+
+  for (auto& [theirGroupNodeToUpdate, theirOldChildren] :
+       theirLinkedGroupUpdates.replacedChildren)
   {
-    const auto myIt = std::ranges::find_if(
-      myLinkedGroupUpdates,
-      [theirGroupNodeToUpdate = theirGroupNodeToUpdate_](const auto& p) {
-        return p.first == theirGroupNodeToUpdate;
-      });
-    if (myIt == std::end(myLinkedGroupUpdates))
+    if (!isReplacedByMe(theirGroupNodeToUpdate))
     {
-      myLinkedGroupUpdates.emplace_back(
-        theirGroupNodeToUpdate_, std::move(theirOldChildren));
+      myLinkedGroupUpdates.replacedChildren.emplace_back(
+        theirGroupNodeToUpdate, std::move(theirOldChildren));
+    }
+  }
+
+  auto mySwappedNodes = std::unordered_set<const mdl::Node*>{};
+  for (const auto& [node, contents] : myLinkedGroupUpdates.swappedContents)
+  {
+    mySwappedNodes.insert(node);
+  }
+
+  for (auto& [theirSwappedNode, theirOldContents] :
+       theirLinkedGroupUpdates.swappedContents)
+  {
+    const auto isInGroupReplacedByMe = std::ranges::any_of(
+      myLinkedGroupUpdates.replacedChildren,
+      [&](const auto& p) { return p.first->isAncestorOf(theirSwappedNode); });
+
+    if (!isInGroupReplacedByMe && !mySwappedNodes.contains(theirSwappedNode))
+    {
+      myLinkedGroupUpdates.swappedContents.emplace_back(
+        theirSwappedNode, std::move(theirOldContents));
     }
   }
 }
@@ -146,21 +191,87 @@ Result<UpdateLinkedGroupsHelper::LinkedGroupUpdates> UpdateLinkedGroupsHelper::
            return mdl::updateLinkedGroups(*groupNode, groupNodesToUpdate, worldBounds);
          })
          | kdl::fold
-         | kdl::and_then([&](auto nestedUpdateLists) -> Result<LinkedGroupUpdates> {
-             return kdl::vec_flatten(std::move(nestedUpdateLists));
+         | kdl::transform([&](auto nestedUpdateLists) {
+             return makeLinkedGroupUpdates(
+               kdl::vec_flatten(std::move(nestedUpdateLists)));
            });
 }
 
-void UpdateLinkedGroupsHelper::doApplyOrUndoLinkedGroupUpdates(
-  MapDocumentCommandFacade& document)
+UpdateLinkedGroupsHelper::LinkedGroupUpdates UpdateLinkedGroupsHelper::
+  makeLinkedGroupUpdates(ReplacedChildren childrenToReplace)
 {
-  std::visit(
+  auto linkedGroupUpdates = LinkedGroupUpdates{};
+
+  // Swapping contents in place requires that no linked group contains another one,
+  // otherwise the nodes of the inner group could be replaced with the outer group's
+  // children.
+  const auto groupNodesToUpdate = kdl::vec_transform(
+    childrenToReplace, [](const auto& update) { return update.first; });
+  const auto canSwapContents = !containsNestedGroups(groupNodesToUpdate);
+
+  for (auto& [groupNodeToUpdate, newChildren] : childrenToReplace)
+  {
+    if (canSwapContents)
+    {
+      if (
+        auto contentChanges =
+          mdl::diffLinkedGroupChildren(groupNodeToUpdate->children(), newChildren))
+      {
+        linkedGroupUpdates.swappedContents = kdl::vec_concat(
+          std::move(linkedGroupUpdates.swappedContents), std::move(*contentChanges));
+        continue;
+      }
+    }
+
+    linkedGroupUpdates.replacedChildren.emplace_back(
+      groupNodeToUpdate, std::move(newChildren));
+  }
+
+  return linkedGroupUpdates;
+}
+
+size_t UpdateLinkedGroupsHelper::memoryUsage() const
+{
+  return std::visit(
     kdl::overload(
-      [](const ChangedLinkedGroups&) {},
-      [&](LinkedGroupUpdates&& linkedGroupUpdates) {
-        m_state = document.performReplaceChildren(std::move(linkedGroupUpdates));
+      [](const ChangedLinkedGroups&) { return size_t(0); },
+      [](const LinkedGroupUpdates& linkedGroupUpdates) {
+        auto result = size_t(0);
+        for (const auto& [groupNode, children] : linkedGroupUpdates.replacedChildren)
+        {
+          for (const auto& child : children)
+          {
+            result += mdl::memoryUsage(*child);
+          }
+        }
+        for (const auto& [node, contents] : linkedGroupUpdates.swappedContents)
+        {
+          result += sizeof(node) + contents.memoryUsage();
+        }
+        return result;
       }),
-    std::move(m_state));
+    m_state);
+}
+
+void UpdateLinkedGroupsHelper::swapLinkedGroupContents(
+  MapDocumentCommandFacade& document)
+{
+  if (auto* linkedGroupUpdates = std::get_if<LinkedGroupUpdates>(&m_state);
+      linkedGroupUpdates && !linkedGroupUpdates->swappedContents.empty())
+  {
+    document.performSwapNodeContents(linkedGroupUpdates->swappedContents);
+  }
+}
+
+void UpdateLinkedGroupsHelper::replaceLinkedGroupChildren(
+  MapDocumentCommandFacade& document)
+{
+  if (auto* linkedGroupUpdates = std::get_if<LinkedGroupUpdates>(&m_state);
+      linkedGroupUpdates && !linkedGroupUpdates->replacedChildren.empty())
+  {
+    linkedGroupUpdates->replacedChildren =
+      document.performReplaceChildren(std::move(linkedGroupUpdates->replacedChildren));
+  }
 }
 
 } // namespace tb::ui
@@ -20,6 +20,7 @@
 #pragma once
 
 #include "Result.h"
+#include "mdl/NodeContents.h"
 
 #include <memory>
 #include <utility>
@@ -49,17 +50,31 @@ bool checkLinkedGroupsToUpdate(const std::vector<mdl::GroupNode*>& changedLinked
  *
  * The class is initialized with a vector of group nodes whose changes should be
  * propagated to the members of their respective link sets. When applyLinkedGroupUpdates
- * is first called, a replacement node is created for each linked group that needs to be
- * updated, and these linked groups are replaced with their replacements. Calling
- * applyLinkedGroupUpdates replaces the replacement nodes with their original
- * corresponding groups again, effectively undoing the change.
+ * is first called, new children are computed for each linked group that needs to be
+ * updated. If the new children have the same structure as the current children, only the
+ * contents of the nodes that actually changed are swapped in place. Otherwise, the
+ * children of the linked group are replaced with the new children. Calling
+ * undoLinkedGroupUpdates swaps the contents or children back again, effectively undoing
+ * the change.
+ *
+ * Contents are swapped before children are replaced when applying the updates, and after
+ * children are replaced when undoing them. After collating a helper that replaced the
+ * children of a linked group that this helper updated in place, undoing first restores
+ * the nodes whose contents this helper swapped, and then restores their contents.
  */
 class UpdateLinkedGroupsHelper
 {
 private:
   using ChangedLinkedGroups = std::vector<mdl::GroupNode*>;
-  using LinkedGroupUpdates =
+  using ReplacedChildren =
     std::vector<std::pair<mdl::Node*, std::vector<std::unique_ptr<mdl::Node>>>>;
+  struct LinkedGroupUpdates
+  {
+    // the linked groups whose children were replaced, and the replaced children
+    ReplacedChildren replacedChildren;
+    // the nodes of linked groups updated in place, and their swapped contents
+    std::vector<std::pair<mdl::Node*, mdl::NodeContents>> swappedContents;
+  };
   std::variant<ChangedLinkedGroups, LinkedGroupUpdates> m_state;
 
 public:
@@ -70,12 +85,20 @@ public:
   void undoLinkedGroupUpdates(MapDocumentCommandFacade& document);
   void collateWith(UpdateLinkedGroupsHelper& other);
 
+  /**
+   * Returns an approximation of the number of bytes of memory held by the replaced
+   * children and the swapped contents.
+   */
+  size_t memoryUsage() const;
+
 private:
   Result<void> computeLinkedGroupUpdates(MapDocumentCommandFacade& document);
   static Result<LinkedGroupUpdates> computeLinkedGroupUpdates(
     const ChangedLinkedGroups& changedLinkedGroups, MapDocumentCommandFacade& document);
+  static LinkedGroupUpdates makeLinkedGroupUpdates(ReplacedChildren childrenToReplace);
 
-  void doApplyOrUndoLinkedGroupUpdates(MapDocumentCommandFacade& document);
+  void swapLinkedGroupContents(MapDocumentCommandFacade& document);
+  void replaceLinkedGroupChildren(MapDocumentCommandFacade& document);
 };
 
 } // namespace tb::ui
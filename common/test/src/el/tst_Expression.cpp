@@ -828,6 +828,33 @@ TEST_CASE("ExpressionTest.testOptimize")
                           ExpressionNode{VariableExpression{"a"}}}
                       }}},
   {"{a:1, b:2, c:3}", ExpressionNode{LiteralExpression{Value{MapType{{"a", Value{1}}, {"b", Value{2}}, {"c", Value{3}}}}}}},
+  {"{a:1, b:x}",      ExpressionNode{MapExpression{{
+                          {"a", ExpressionNode{LiteralExpression{Value{1}}}},
+                          {"b", ExpressionNode{VariableExpression{"x"}}}}
+                      }}},
+  {"[1..3]",          ExpressionNode{LiteralExpression{Value{ArrayType{Value{1}, Value{2}, Value{3}}}}}},
+  {"a == 1",          ExpressionNode{BinaryExpression{
+                          BinaryOperation::Equal,
+                          ExpressionNode{VariableExpression{"a"}},
+                          ExpressionNode{LiteralExpression{Value{1}}}}
+                      }},
+  {"false && a",      ExpressionNode{LiteralExpression{Value{false}}}},
+  {"!a",              ExpressionNode{UnaryExpression{
+                          UnaryOperation::LogicalNegation,
+                          ExpressionNode{VariableExpression{"a"}}}
+                      }},
+  {"a[0]",            ExpressionNode{SubscriptExpression{
+                          ExpressionNode{VariableExpression{"a"}},
+                          ExpressionNode{LiteralExpression{Value{0}}}}
+                      }},
+  {"{{ 1 + 1, a }}",  ExpressionNode{LiteralExpression{Value{2}}}},
+  {"{{ a -> 1, 2, 3 }}", ExpressionNode{SwitchExpression{{
+                          ExpressionNode{BinaryExpression{
+                            BinaryOperation::Case,
+                            ExpressionNode{VariableExpression{"a"}},
+                            ExpressionNode{LiteralExpression{Value{1}}}}},
+                          ExpressionNode{LiteralExpression{Value{2}}}}
+                      }}},
   }));
   // clang-format on
 
@@ -836,6 +863,28 @@ TEST_CASE("ExpressionTest.testOptimize")
   CHECK(io::ELParser::parseStrict(expression).optimize() == expectedExpression);
 }
 
+TEST_CASE("ExpressionTest.variableNames")
+{
+  using T = std::tuple<std::string, std::vector<std::string>>;
+
+  // clang-format off
+  const auto
+  [expression,                     expectedVariableNames] = GENERATE(values<T>({
+  {"1",                            {}},
+  {"a",                            {"a"}},
+  {"[b, 1, a]",                    {"a", "b"}},
+  {"{x: a, y: -b}",                {"a", "b"}},
+  {"a + a * c",                    {"a", "c"}},
+  {"a[b]",                         {"a", "b"}},
+  {"{{ a == 1 -> b, a == 2 -> c }}", {"a", "b", "c"}},
+  }));
+  // clang-format on
+
+  CAPTURE(expression);
+
+  CHECK(io::ELParser::parseStrict(expression).variableNames() == expectedVariableNames);
+}
+
 namespace
 {
 std::vector<std::string> preorderVisit(const std::string& str)
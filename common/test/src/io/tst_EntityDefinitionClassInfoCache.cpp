@@ -0,0 +1,146 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Color.h"
+#include "io/EntityDefinitionClassInfo.h"
+#include "io/EntityDefinitionClassInfoCache.h"
+#include "io/FgdParser.h"
+#include "io/RecordingParserStatus.h"
+#include "io/TestEnvironment.h"
+#include "io/TestParserStatus.h"
+
+#include "kdl/vector_utils.h"
+
+#include <string>
+#include <vector>
+
+#include "Catch2.h"
+
+namespace tb::io
+{
+namespace
+{
+
+const auto HostFgd = std::string{R"(
+@SolidClass = worldspawn : "World entity" []
+@include "include.fgd"
+)"};
+
+const auto IncludeFgd = std::string{R"(
+@PointClass = info_player_start : "Player 1 start" []
+)"};
+
+std::vector<std::string> classNames(
+  const std::vector<EntityDefinitionClassInfo>& classInfos)
+{
+  return kdl::vec_transform(
+    classInfos, [](const auto& classInfo) { return classInfo.name; });
+}
+
+} // namespace
+
+TEST_CASE("EntityDefinitionClassInfoCache")
+{
+  auto env = TestEnvironment{[](auto& e) {
+    e.createFile("host.fgd", HostFgd);
+    e.createFile("include.fgd", IncludeFgd);
+  }};
+
+  const auto hostPath = env.dir() / "host.fgd";
+
+  auto parser = FgdParser{HostFgd, Color{}, hostPath};
+  auto status = TestParserStatus{};
+  auto recordingStatus = RecordingParserStatus{status};
+  auto classInfos = parser.parseClassInfos(recordingStatus);
+  REQUIRE(
+    classNames(classInfos)
+    == std::vector<std::string>{"worldspawn", "info_player_start"});
+  REQUIRE(
+    parser.includedPaths()
+    == std::vector<std::filesystem::path>{env.dir() / "include.fgd"});
+
+  auto cache = EntityDefinitionClassInfoCache{};
+  CHECK(cache.find(status, hostPath, HostFgd) == std::nullopt);
+
+  cache.insert(
+    hostPath, HostFgd, parser.includedPaths(), classInfos, recordingStatus.messages());
+
+  SECTION("Returns cached class infos for unchanged files")
+  {
+    CHECK(cache.find(status, hostPath, HostFgd) == classInfos);
+  }
+
+  SECTION("Replays the messages logged while parsing")
+  {
+    REQUIRE(status.countStatus(LogLevel::Debug) > 0);
+
+    auto replayStatus = TestParserStatus{};
+    REQUIRE(cache.find(replayStatus, hostPath, HostFgd) == classInfos);
+    CHECK(replayStatus.messages(LogLevel::Debug) == status.messages(LogLevel::Debug));
+  }
+
+  SECTION("Misses if the file has changed")
+  {
+    CHECK(cache.find(status, hostPath, HostFgd + "\n") == std::nullopt);
+  }
+
+  SECTION("Misses if an included file has changed")
+  {
+    env.createFile("include.fgd", IncludeFgd + "\n");
+    CHECK(cache.find(status, hostPath, HostFgd) == std::nullopt);
+  }
+
+  SECTION("Misses after clearing")
+  {
+    cache.clear();
+    CHECK(cache.find(status, hostPath, HostFgd) == std::nullopt);
+  }
+}
+
+TEST_CASE("EntityDefinitionClassInfoCache.missingInclude")
+{
+  auto env = TestEnvironment{[](auto& e) { e.createFile("host.fgd", HostFgd); }};
+
+  const auto hostPath = env.dir() / "host.fgd";
+
+  auto parser = FgdParser{HostFgd, Color{}, hostPath};
+  auto status = TestParserStatus{};
+  auto classInfos = parser.parseClassInfos(status);
+  REQUIRE(classNames(classInfos) == std::vector<std::string>{"worldspawn"});
+  REQUIRE(status.countStatus(LogLevel::Error) == 1);
+  REQUIRE(
+    parser.includedPaths()
+    == std::vector<std::filesystem::path>{env.dir() / "include.fgd"});
+
+  auto cache = EntityDefinitionClassInfoCache{};
+  cache.insert(hostPath, HostFgd, parser.includedPaths(), classInfos, {});
+
+  SECTION("Returns cached class infos while the included file is missing")
+  {
+    CHECK(cache.find(status, hostPath, HostFgd) == classInfos);
+  }
+
+  SECTION("Misses once the included file appears")
+  {
+    env.createFile("include.fgd", IncludeFgd);
+    CHECK(cache.find(status, hostPath, HostFgd) == std::nullopt);
+  }
+}
+
+} // namespace tb::io
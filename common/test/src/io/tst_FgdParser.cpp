@@ -17,6 +17,8 @@
  along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "el/Expression.h"
+#include "el/Value.h"
 #include "io/DiskIO.h"
 #include "io/FgdParser.h"
 #include "io/Reader.h"
@@ -24,6 +26,7 @@
 #include "io/TraversalMode.h"
 #include "mdl/EntityDefinition.h"
 #include "mdl/EntityDefinitionTestUtils.h"
+#include "mdl/ModelDefinition.h"
 #include "mdl/PropertyDefinition.h"
 
 #include <algorithm>
@@ -809,6 +812,29 @@ TEST_CASE("FgdParserTest.parseELModelDefinition")
     FgdModelDefinitionTemplate);
 }
 
+TEST_CASE("FgdParserTest.parseConstantELModelDefinitionIsFolded")
+{
+  const auto file = R"(
+@PointClass model({ "path": "maps/b_shell0.bsp", "skin": 1 + 1 }) = item_shells : "Shells" [])";
+
+  auto parser = FgdParser{file, Color{1.0f, 1.0f, 1.0f, 1.0f}};
+
+  auto status = TestParserStatus{};
+  auto definitions = parser.parseDefinitions(status);
+  REQUIRE(definitions.size() == 1u);
+
+  const auto& pointDefinition =
+    static_cast<const mdl::PointEntityDefinition&>(*definitions.front());
+  CHECK(
+    pointDefinition.modelDefinition()
+    == mdl::ModelDefinition{el::ExpressionNode{el::LiteralExpression{el::Value{
+      el::MapType{
+        {"path", el::Value{"maps/b_shell0.bsp"}},
+        {"skin", el::Value{2.0}},
+      },
+    }}}});
+}
+
 TEST_CASE("FgdParserTest.parseLegacyModelWithParseError")
 {
   const auto file = R"(
@@ -267,6 +267,36 @@ TEST_CASE("BrushTest.cloneFaceAttributesFrom")
   CHECK(newBrush == brush);
 }
 
+TEST_CASE("BrushTest.copySharesGeometry")
+{
+  const auto worldBounds = vm::bbox3d{4096.0};
+
+  const auto brushBuilder = BrushBuilder{MapFormat::Standard, worldBounds};
+  const auto original = brushBuilder.createCube(64.0, "material") | kdl::value();
+
+  auto copy = original;
+  REQUIRE(copy.faceCount() == original.faceCount());
+  for (size_t i = 0; i < copy.faceCount(); ++i)
+  {
+    CHECK(copy.face(i).geometry() != nullptr);
+    CHECK(copy.face(i).geometry() == original.face(i).geometry());
+  }
+  CHECK(copy == original);
+  CHECK(copy.isGeometryShared());
+  CHECK(original.isGeometryShared());
+
+  const auto topFaceIndex = copy.findFace(vm::vec3d{0, 0, 1});
+  REQUIRE(topFaceIndex != std::nullopt);
+  REQUIRE(copy.moveBoundary(worldBounds, *topFaceIndex, vm::vec3d{0, 0, 16}, false)
+            .is_success());
+
+  CHECK(copy.bounds() == vm::bbox3d{{-32, -32, -32}, {32, 32, 48}});
+  CHECK(original.bounds() == vm::bbox3d{{-32, -32, -32}, {32, 32, 32}});
+  CHECK(original.face(*topFaceIndex).geometry() != copy.face(*topFaceIndex).geometry());
+  CHECK_FALSE(copy.isGeometryShared());
+  CHECK_FALSE(original.isGeometryShared());
+}
+
 TEST_CASE("BrushTest.clip")
 {
   const auto worldBounds = vm::bbox3d{4096.0};
@@ -2275,4 +2305,31 @@ TEST_CASE("BrushTest.subtractEnclosed")
   CHECK(fragments.empty());
 }
 
+TEST_CASE("BrushTest.subtractMultipleMergesFragments")
+{
+  const auto worldBounds = vm::bbox3d{4096.0};
+
+  auto builder = BrushBuilder{MapFormat::Standard, worldBounds};
+  const auto minuend =
+    builder.createCuboid(vm::bbox3d{{0, 0, 0}, {64, 64, 64}}, "material") | kdl::value();
+  const auto subtrahend1 =
+    builder.createCuboid(vm::bbox3d{{0, 0, 0}, {32, 32, 64}}, "material") | kdl::value();
+  const auto subtrahend2 =
+    builder.createCuboid(vm::bbox3d{{32, 0, 0}, {64, 32, 64}}, "material")
+    | kdl::value();
+  const auto distantSubtrahend =
+    builder.createCuboid(vm::bbox3d{{128, 0, 0}, {160, 32, 64}}, "material")
+    | kdl::value();
+
+  const auto fragments =
+    minuend.subtract(
+      MapFormat::Standard,
+      worldBounds,
+      "material",
+      {&subtrahend1, &distantSubtrahend, &subtrahend2})
+    | kdl::fold | kdl::value();
+  REQUIRE(fragments.size() == 1u);
+  CHECK(fragments.front().bounds() == vm::bbox3d{{0, 32, 0}, {64, 64, 64}});
+}
+
 } // namespace tb::mdl
@@ -540,6 +540,52 @@ TEST_CASE("BrushFaceTest.materialUsageCount")
   CHECK(material2.usageCount() == 0u);
 }
 
+TEST_CASE("BrushFaceTest.uvProjection")
+{
+  const auto p0 = vm::vec3d{0, 0, 4};
+  const auto p1 = vm::vec3d{1, 0, 4};
+  const auto p2 = vm::vec3d{0, -1, 4};
+  auto material = Material{"testMaterial", createTextureResource(Texture{64, 32})};
+
+  auto attribs = BrushFaceAttributes{"testMaterial"};
+  attribs.setOffset(vm::vec2f{7, -3});
+  attribs.setScale(vm::vec2f{0.5f, -2.0f});
+  attribs.setRotation(30.0f);
+
+  auto uvCoordSystem = std::unique_ptr<UVCoordSystem>{};
+  SECTION("Paraxial")
+  {
+    uvCoordSystem = std::make_unique<ParaxialUVCoordSystem>(p0, p1, p2, attribs);
+  }
+  SECTION("Parallel")
+  {
+    uvCoordSystem = std::make_unique<ParallelUVCoordSystem>(p0, p1, p2, attribs);
+  }
+
+  auto face = BrushFace::create(p0, p1, p2, attribs, std::move(uvCoordSystem))
+              | kdl::value();
+  face.setMaterial(&material);
+
+  const auto toUV = face.toUVCoordSystemMatrix(
+    face.attributes().offset(), face.attributes().scale(), true);
+  const auto textureSize = vm::vec2d{64, 32};
+
+  const auto uvProjection = face.uvProjection();
+  for (const auto& point : {
+         vm::vec3d{0, 0, 4},
+         vm::vec3d{13, -7, 4},
+         vm::vec3d{-128, 256, 4},
+         vm::vec3d{1000.5, 31.25, 4},
+       })
+  {
+    const auto expected = vm::vec2d{(toUV * point).xy()} / textureSize;
+    CHECK(
+      vm::vec2d{uvProjection.uvCoords(point)}
+      == vm::approx<vm::vec2d>{expected, 0.0001});
+    CHECK(uvProjection.uvCoords(point) == face.uvCoords(point));
+  }
+}
+
 TEST_CASE("BrushFaceTest.projectedArea")
 {
   const auto worldBounds = vm::bbox3d{8192.0};
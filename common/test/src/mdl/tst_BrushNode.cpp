@@ -35,6 +35,7 @@
 #include "kdl/result.h"
 
 #include "vm/approx.h"
+#include "vm/intersection.h"
 
 #include <memory>
 #include <string>
@@ -300,6 +301,86 @@ TEST_CASE("BrushNodeTest.pick")
   CHECK(hits2.empty());
 }
 
+TEST_CASE("BrushNodeTest.pickMatchesExhaustiveSearch")
+{
+  const auto worldBounds = vm::bbox3d{4096.0};
+  const auto editorContext = EditorContext{};
+
+  auto builder = BrushBuilder{MapFormat::Quake3, worldBounds};
+  auto brushNode = BrushNode{
+    builder.createCylinder(
+      vm::bbox3d{{-32, -32, -16}, {32, 32, 16}},
+      12,
+      RadiusMode::ToEdge,
+      vm::axis::z,
+      "material")
+    | kdl::value()};
+  const auto& brush = brushNode.brush();
+
+  // aim at the vertices, the edge centers and some points inside and outside the brush
+  auto targets = brush.vertexPositions();
+  for (const auto* edge : brush.edges())
+  {
+    targets.push_back(edge->center());
+  }
+  for (const auto& target : {
+         vm::vec3d{0, 0, 0},
+         vm::vec3d{8, -4, 15},
+         vm::vec3d{31, 0, 0},
+         vm::vec3d{40, 40, 0},
+         vm::vec3d{0, 0, 17},
+       })
+  {
+    targets.push_back(target);
+  }
+
+  const auto origins = std::vector<vm::vec3d>{
+    {100, 0, 0},
+    {-100, 20, 30},
+    {0, 0, 100},
+    {7, -3, -80},
+    {60, 60, 60},
+    {0, 0, 0},
+  };
+
+  for (const auto& origin : origins)
+  {
+    for (const auto& target : targets)
+    {
+      if (origin == target)
+      {
+        continue;
+      }
+
+      const auto ray = vm::ray3d{origin, vm::normalize(target - origin)};
+      CAPTURE(ray);
+
+      auto expected = std::optional<std::tuple<double, size_t>>{};
+      if (vm::intersect_ray_bbox(ray, brush.bounds()))
+      {
+        for (size_t i = 0; i < brush.faceCount() && !expected; ++i)
+        {
+          if (const auto distance = brush.face(i).intersectWithRay(ray))
+          {
+            expected = std::tuple{*distance, i};
+          }
+        }
+      }
+
+      auto pickResult = PickResult{};
+      brushNode.pick(editorContext, ray, pickResult);
+
+      REQUIRE(pickResult.size() == (expected ? 1u : 0u));
+      if (expected)
+      {
+        const auto& hit = pickResult.all().front();
+        CHECK(hit.distance() == std::get<0>(*expected));
+        CHECK(hitToFaceHandle(hit)->faceIndex() == std::get<1>(*expected));
+      }
+    }
+  }
+}
+
 TEST_CASE("BrushNodeTest.clone")
 {
   const vm::bbox3d worldBounds(4096.0);
@@ -191,6 +191,24 @@ TEST_CASE("EntityTest")
 
     entity.addOrUpdateProperty(EntityPropertyKeys::Spawnflags, "1");
     CHECK(entity.modelSpecification() == ModelSpecification{"maps/b_shell1.bsp", 0, 0});
+
+    entity.addOrUpdateProperty("target", "some_target");
+    CHECK(entity.modelSpecification() == ModelSpecification{"maps/b_shell1.bsp", 0, 0});
+
+    entity.renameProperty(EntityPropertyKeys::Spawnflags, "flags");
+    CHECK(entity.modelSpecification() == ModelSpecification{"maps/b_shell0.bsp", 0, 0});
+
+    entity.renameProperty("flags", EntityPropertyKeys::Spawnflags);
+    CHECK(entity.modelSpecification() == ModelSpecification{"maps/b_shell1.bsp", 0, 0});
+
+    entity.removeProperty(EntityPropertyKeys::Spawnflags);
+    CHECK(entity.modelSpecification() == ModelSpecification{"maps/b_shell0.bsp", 0, 0});
+
+    entity.setProperties({{EntityPropertyKeys::Spawnflags, "2"}});
+    CHECK(entity.modelSpecification() == ModelSpecification{"maps/b_shell2.bsp", 0, 0});
+
+    entity.setDefinition(nullptr);
+    CHECK(entity.modelSpecification() == ModelSpecification{});
   }
 
   SECTION("decalSpecification")
@@ -212,6 +230,12 @@ TEST_CASE("EntityTest")
 
     entity.addOrUpdateProperty("texture", "decal1");
     CHECK(entity.decalSpecification() == DecalSpecification{"decal1"});
+
+    entity.addOrUpdateProperty(EntityPropertyKeys::Spawnflags, "1");
+    CHECK(entity.decalSpecification() == DecalSpecification{"decal1"});
+
+    entity.removeProperty("texture");
+    CHECK(entity.decalSpecification() == DecalSpecification{""});
   }
 
   SECTION("unsetEntityDefinitionAndModel")
@@ -430,6 +454,19 @@ TEST_CASE("EntityTest")
     CHECK(entity.hasProperty("key"));
   }
 
+  SECTION("propertyKeysAreShared")
+  {
+    const auto entity1 = Entity{{{"classname", "light"}, {"origin", "0 0 0"}}};
+    const auto entity2 = Entity{{{"origin", "1 1 1"}, {"classname", "info_null"}}};
+
+    CHECK(&entity1.properties()[0].key() == &entity2.properties()[1].key());
+    CHECK(&entity1.properties()[1].key() == &entity2.properties()[0].key());
+    CHECK(EntityPropertyKey{"origin"} == EntityPropertyKey{std::string{"origin"}});
+    CHECK(EntityPropertyKey{"classname"} < EntityPropertyKey{"origin"});
+    CHECK(entity2.properties()[1].hasKey(entity1.properties()[0].key()));
+    CHECK(entity2.properties()[0] != entity1.properties()[1]);
+  }
+
   SECTION("originUpdateWithSetProperties")
   {
     auto entity = Entity{};
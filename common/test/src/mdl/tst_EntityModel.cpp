@@ -28,12 +28,14 @@
 #include "mdl/TextureResource.h"
 #include "render/IndexRangeMapBuilder.h"
 #include "render/MaterialIndexRangeRenderer.h"
+#include "render/PrimType.h"
 
 #include "vm/approx.h"
 #include "vm/bbox.h"
 #include "vm/intersection.h"
 
 #include <filesystem>
+#include <vector>
 
 #include "Catch2.h"
 
@@ -87,6 +89,33 @@ TEST_CASE("BSP model intersection test")
   CHECK(vm::intersect_ray_bbox(missRay, box) == std::nullopt);
 }
 
+TEST_CASE("EntityModelTest.EntityModelFrame.intersect")
+{
+  auto frame = EntityModelFrame{0, "frame", vm::bbox3f{4.0f}};
+
+  const auto quad = std::vector<EntityModelVertex>{
+    EntityModelVertex{vm::vec3f{-1, -1, 0}, vm::vec2f{0, 0}},
+    EntityModelVertex{vm::vec3f{1, -1, 0}, vm::vec2f{0, 0}},
+    EntityModelVertex{vm::vec3f{1, 1, 0}, vm::vec2f{0, 0}},
+    EntityModelVertex{vm::vec3f{-1, 1, 0}, vm::vec2f{0, 0}},
+  };
+  frame.addTrianglesForHitTesting(quad, render::PrimType::Quads, 0, 4);
+
+  CHECK(frame.intersect(vm::ray3f{{0.5, 0.5, 4}, {0, 0, -1}}) == vm::approx{4.0f});
+  CHECK(frame.intersect(vm::ray3f{{3, 3, 4}, {0, 0, -1}}) == std::nullopt);
+
+  // adding primitives after the frame was intersected must be reflected
+  const auto triangle = std::vector<EntityModelVertex>{
+    EntityModelVertex{vm::vec3f{2, 2, 1}, vm::vec2f{0, 0}},
+    EntityModelVertex{vm::vec3f{4, 2, 1}, vm::vec2f{0, 0}},
+    EntityModelVertex{vm::vec3f{4, 4, 1}, vm::vec2f{0, 0}},
+  };
+  frame.addTrianglesForHitTesting(triangle, render::PrimType::Triangles, 0, 3);
+
+  CHECK(frame.intersect(vm::ray3f{{3.5, 2.5, 4}, {0, 0, -1}}) == vm::approx{3.0f});
+  CHECK(frame.intersect(vm::ray3f{{0.5, 0.5, 4}, {0, 0, -1}}) == vm::approx{4.0f});
+}
+
 static Material makeDummyMaterial(std::string name)
 {
   auto textureResource = createTextureResource(Texture{1, 1});
@@ -198,6 +198,55 @@ TEST_CASE("EntityNodeIndex")
       index.allValuesForKeys(EntityNodeIndexQuery::exact("test")),
       Catch::UnorderedEquals(std::vector<std::string>{"somevalue", "somevalue2"}));
   }
+
+  SECTION("allValuesForNumberedKeys")
+  {
+    auto entity1 = EntityNode{Entity{{
+      {"target", "a"},
+      {"target1", "b"},
+      {"target2", "a"},
+      {"targetname", "c"},
+    }}};
+
+    index.addEntityNode(&entity1);
+
+    CHECK_THAT(
+      index.allValuesForKeys(EntityNodeIndexQuery::numbered("target")),
+      Catch::UnorderedEquals(std::vector<std::string>{"a", "b"}));
+    CHECK_THAT(
+      index.allValuesForKeys(EntityNodeIndexQuery::prefix("target")),
+      Catch::UnorderedEquals(std::vector<std::string>{"a", "b", "c"}));
+
+    index.removeProperty(&entity1, "target2", "a");
+    CHECK_THAT(
+      index.allValuesForKeys(EntityNodeIndexQuery::numbered("target")),
+      Catch::UnorderedEquals(std::vector<std::string>{"a", "b"}));
+
+    index.removeProperty(&entity1, "target", "a");
+    CHECK_THAT(
+      index.allValuesForKeys(EntityNodeIndexQuery::numbered("target")),
+      Catch::UnorderedEquals(std::vector<std::string>{"b"}));
+  }
+
+  SECTION("findEntityNodesWithSharedValue")
+  {
+    auto entity1 = EntityNode{Entity{{
+      {"target", "somevalue"},
+      {"killtarget", "somevalue"},
+    }}};
+
+    index.addEntityNode(&entity1);
+
+    CHECK(
+      findExactExact(index, "target", "somevalue")
+      == std::vector<EntityNodeBase*>{&entity1});
+
+    index.removeProperty(&entity1, "killtarget", "somevalue");
+    CHECK(
+      findExactExact(index, "target", "somevalue")
+      == std::vector<EntityNodeBase*>{&entity1});
+    CHECK(index.findEntityNodesWithValue("somevalue").size() == 1u);
+  }
 }
 
 } // namespace tb::mdl
@@ -24,6 +24,7 @@
 #include "mdl/MapFormat.h"
 #include "mdl/WorldNode.h"
 
+#include <string>
 #include <vector>
 
 #include "Catch2.h"
@@ -422,4 +423,36 @@ TEST_CASE("EntityNodeLinkTest.testRemoveKillLinkByRemovingTarget")
   delete targetNode;
 }
 
+TEST_CASE("EntityNodeLinkTest.findMissingTargets")
+{
+  auto worldNode = WorldNode{{}, {}, MapFormat::Standard};
+  auto* sourceNode = new EntityNode(Entity{{
+    {"target", "a"},
+    {"target2", "b"},
+    {"target3", ""},
+    {"killtarget", "a"},
+    {"killtarget1", "c"},
+  }});
+  auto* targetNode = new EntityNode(Entity{{{EntityPropertyKeys::Targetname, "a"}}});
+
+  worldNode.defaultLayer()->addChild(sourceNode);
+  worldNode.defaultLayer()->addChild(targetNode);
+
+  CHECK_THAT(
+    sourceNode->findMissingLinkTargets(),
+    Catch::UnorderedEquals(std::vector<std::string>{"target2", "target3"}));
+  CHECK_THAT(
+    sourceNode->findMissingKillTargets(),
+    Catch::UnorderedEquals(std::vector<std::string>{"killtarget1"}));
+
+  targetNode->setEntity(Entity{{{EntityPropertyKeys::Targetname, "b"}}});
+
+  CHECK_THAT(
+    sourceNode->findMissingLinkTargets(),
+    Catch::UnorderedEquals(std::vector<std::string>{"target", "target3"}));
+  CHECK_THAT(
+    sourceNode->findMissingKillTargets(),
+    Catch::UnorderedEquals(std::vector<std::string>{"killtarget", "killtarget1"}));
+}
+
 } // namespace tb::mdl
@@ -158,6 +158,93 @@ TEST_CASE("GroupNode.updateLinkedGroups")
         })
       | kdl::transform_error([](const auto&) { FAIL(); });
   }
+
+  SECTION("Update multiple target groups")
+  {
+    auto groupNodeClones = std::vector<std::unique_ptr<GroupNode>>{};
+    for (size_t i = 0; i < 8; ++i)
+    {
+      auto groupNodeClone = std::unique_ptr<GroupNode>{
+        static_cast<GroupNode*>(groupNode.cloneRecursively(worldBounds))};
+      transformNode(
+        *groupNodeClone,
+        vm::translation_matrix(vm::vec3d{0, double(i + 1), 0}),
+        worldBounds);
+      groupNodeClones.push_back(std::move(groupNodeClone));
+    }
+
+    transformNode(*entityNode, vm::translation_matrix(vm::vec3d{0, 0, 3}), worldBounds);
+
+    const auto targetGroupNodes = kdl::vec_transform(
+      groupNodeClones, [](const auto& groupNodeClone) { return groupNodeClone.get(); });
+
+    updateLinkedGroups(groupNode, targetGroupNodes, worldBounds)
+      | kdl::transform([&](const UpdateLinkedGroupsResult& r) {
+          REQUIRE(r.size() == targetGroupNodes.size());
+
+          for (size_t i = 0; i < r.size(); ++i)
+          {
+            const auto& [groupNodeToUpdate, newChildren] = r[i];
+            CHECK(groupNodeToUpdate == targetGroupNodes[i]);
+            REQUIRE(newChildren.size() == 1u);
+
+            const auto* newEntityNode =
+              dynamic_cast<EntityNode*>(newChildren.front().get());
+            REQUIRE(newEntityNode != nullptr);
+            CHECK(newEntityNode->entity().origin() == vm::vec3d{1, double(i + 1), 3});
+          }
+        })
+      | kdl::transform_error([](const auto&) { FAIL(); });
+  }
+}
+
+TEST_CASE("GroupNode.diffLinkedGroupChildren")
+{
+  const auto worldBounds = vm::bbox3d{8192.0};
+
+  auto groupNode = GroupNode{Group{"name"}};
+  auto* entityNode1 = new EntityNode{Entity{{{"key", "value1"}}}};
+  auto* entityNode2 = new EntityNode{Entity{{{"key", "value2"}}}};
+  groupNode.addChildren({entityNode1, entityNode2});
+
+  auto newChildren = kdl::vec_transform(groupNode.children(), [&](const auto* child) {
+    return std::unique_ptr<Node>{child->cloneRecursively(worldBounds)};
+  });
+
+  SECTION("Unchanged children")
+  {
+    const auto changes = diffLinkedGroupChildren(groupNode.children(), newChildren);
+    REQUIRE(changes.has_value());
+    CHECK(changes->empty());
+  }
+
+  SECTION("Changed entity")
+  {
+    auto& newEntityNode2 = static_cast<EntityNode&>(*newChildren[1]);
+    auto newEntity2 = newEntityNode2.entity();
+    newEntity2.addOrUpdateProperty("key", "value3");
+    newEntityNode2.setEntity(std::move(newEntity2));
+
+    const auto changes = diffLinkedGroupChildren(groupNode.children(), newChildren);
+    REQUIRE(changes.has_value());
+    REQUIRE(changes->size() == 1u);
+
+    const auto& [changedNode, newContents] = changes->front();
+    CHECK(changedNode == entityNode2);
+    CHECK(std::get<Entity>(newContents.get()) == newEntityNode2.entity());
+  }
+
+  SECTION("Added child")
+  {
+    newChildren.push_back(std::make_unique<EntityNode>(Entity{}));
+    CHECK(diffLinkedGroupChildren(groupNode.children(), newChildren) == std::nullopt);
+  }
+
+  SECTION("Different link IDs")
+  {
+    static_cast<EntityNode&>(*newChildren[0]).setLinkId("other");
+    CHECK(diffLinkedGroupChildren(groupNode.children(), newChildren) == std::nullopt);
+  }
 }
 
 TEST_CASE("GroupNode.updateNestedLinkedGroups")
@@ -23,7 +23,9 @@
 #include "mdl/ModelDefinition.h"
 
 #include <map>
+#include <string>
 #include <tuple>
+#include <vector>
 
 #include "Catch2.h"
 
@@ -55,6 +57,22 @@ TEST_CASE("ModelDefinition")
       == ModelSpecification{"maps/b_shell0.bsp", 0, 0});
   }
 
+  SECTION("propertyKeys")
+  {
+    auto d1 = makeModelDefinition(R"({{
+      spawnflags == 1 -> { path: model, skin: skin },
+                         "maps/b_shell1.bsp"
+    }})");
+    CHECK(d1.propertyKeys() == std::vector<std::string>{"model", "skin", "spawnflags"});
+
+    d1.append(makeModelDefinition(R"({ path: "maps/b_shell2.bsp", frame: frame })"));
+    CHECK(
+      d1.propertyKeys()
+      == std::vector<std::string>{"frame", "model", "skin", "spawnflags"});
+
+    CHECK(ModelDefinition{}.propertyKeys().empty());
+  }
+
   SECTION("modelSpecification")
   {
     using T =
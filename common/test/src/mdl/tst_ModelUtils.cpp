@@ -255,6 +255,57 @@ TEST_CASE("ModelUtils.collectTouchingNodes")
       std::vector<Node*>{&groupNode, &entityNode, &brushNode, &patchNode}));
 }
 
+TEST_CASE("ModelUtils.collectTouchingNodes.world")
+{
+  constexpr auto worldBounds = vm::bbox3d{8192.0};
+  constexpr auto mapFormat = MapFormat::Quake3;
+
+  auto builder = BrushBuilder{mapFormat, worldBounds};
+
+  auto worldNode = WorldNode{{}, {}, mapFormat};
+  auto* groupNode = new GroupNode{Group{"group"}};
+  auto* entityNode = new EntityNode{Entity{}};
+  auto* brushNode = new BrushNode{builder.createCube(64.0, "material") | kdl::value()};
+  auto* groupedBrushNode = new BrushNode{
+    builder.createCuboid(vm::bbox3d{{256, -32, -32}, {320, 32, 32}}, "material")
+    | kdl::value()};
+  auto* distantBrushNode = new BrushNode{
+    builder.createCuboid(vm::bbox3d{{1024, -32, -32}, {1088, 32, 32}}, "material")
+    | kdl::value()};
+
+  groupNode->addChild(groupedBrushNode);
+  worldNode.defaultLayer()->addChildren(
+    {groupNode, entityNode, brushNode, distantBrushNode});
+
+  auto touchesBrushAndGroup = BrushNode{
+    builder.createCuboid(vm::bbox3d{{16, -8, -8}, {272, 8, 8}}, "material")
+    | kdl::value()};
+  auto touchesEntity = BrushNode{builder.createCube(8.0, "material") | kdl::value()};
+  auto touchesNothing = BrushNode{
+    builder.createCuboid(vm::bbox3d{{512, -8, -8}, {528, 8, 8}}, "material")
+    | kdl::value()};
+
+  CHECK_THAT(
+    collectTouchingNodes({&worldNode}, {&touchesBrushAndGroup}),
+    Catch::Matchers::UnorderedEquals(std::vector<Node*>{brushNode, groupNode}));
+
+  CHECK_THAT(
+    collectTouchingNodes({&worldNode}, {&touchesEntity}),
+    Catch::Matchers::UnorderedEquals(std::vector<Node*>{entityNode, brushNode}));
+
+  CHECK_THAT(
+    collectTouchingNodes({&worldNode}, {&touchesNothing}),
+    Catch::Matchers::Equals(std::vector<Node*>{}));
+
+  CHECK_THAT(
+    collectTouchingNodes({&worldNode}, {&touchesNothing, distantBrushNode}),
+    Catch::Matchers::Equals(std::vector<Node*>{}));
+
+  CHECK_THAT(
+    collectContainedNodes({&worldNode}, {&touchesBrushAndGroup}),
+    Catch::Matchers::Equals(std::vector<Node*>{}));
+}
+
 TEST_CASE("ModelUtils.collectContainedNodes")
 {
   constexpr auto worldBounds = vm::bbox3d{8192.0};
@@ -0,0 +1,81 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mdl/Brush.h"
+#include "mdl/BrushBuilder.h"
+#include "mdl/BrushFace.h"
+#include "mdl/Entity.h"
+#include "mdl/MapFormat.h"
+#include "mdl/NodeContents.h"
+
+#include "kdl/result.h"
+
+#include "vm/mat_ext.h"
+
+#include "Catch2.h"
+
+namespace tb::mdl
+{
+
+TEST_CASE("NodeContents.memoryUsage")
+{
+  const auto worldBounds = vm::bbox3d{8192.0};
+
+  SECTION("Brush geometry is only counted if it is not shared")
+  {
+    const auto brushBuilder = BrushBuilder{MapFormat::Standard, worldBounds};
+    auto brush = brushBuilder.createCube(64.0, "material") | kdl::value();
+
+    // the contents an undo snapshot keeps of the brush before it is changed
+    const auto snapshot = NodeContents{brush};
+
+    auto attributes = brush.face(0).attributes();
+    attributes.setXOffset(16.0f);
+    brush.face(0).setAttributes(attributes);
+
+    REQUIRE(brush.isGeometryShared());
+    const auto attributeChangeUsage = snapshot.memoryUsage();
+
+    REQUIRE(brush
+              .transform(worldBounds, vm::translation_matrix(vm::vec3d{16, 0, 0}), false)
+              .is_success());
+
+    REQUIRE_FALSE(brush.isGeometryShared());
+    const auto geometryChangeUsage = snapshot.memoryUsage();
+
+    const auto geometryUsage =
+      sizeof(BrushGeometry) + brush.vertexCount() * sizeof(BrushVertex)
+      + brush.edgeCount() * (sizeof(BrushEdge) + 2 * sizeof(BrushHalfEdge))
+      + brush.faceCount() * sizeof(BrushFaceGeometry);
+    CHECK(geometryChangeUsage == attributeChangeUsage + geometryUsage);
+  }
+
+  SECTION("Entity property keys are not counted")
+  {
+    const auto shortKeys = NodeContents{Entity{{{"a", "value"}, {"b", "value"}}}};
+    const auto longKeys = NodeContents{Entity{{
+      {"a_very_long_property_key_that_is_not_stored_inline", "value"},
+      {"another_very_long_property_key_that_is_not_stored_inline", "value"},
+    }}};
+
+    CHECK(longKeys.memoryUsage() == shortKeys.memoryUsage());
+  }
+}
+
+} // namespace tb::mdl
@@ -163,6 +163,55 @@ TEST_CASE("PatchNode.makePatchGrid")
     == kdl::vec_transform(expectedPoints, [](const auto& p) { return vm::approx{p}; }));
 }
 
+TEST_CASE("PatchNode.selectPatchSubdivisions")
+{
+  const auto bounds = vm::bbox3d{{0, 0, 0}, {4, 4, 0}};
+
+  using T = std::tuple<vm::vec3d, size_t>;
+
+  // clang-format off
+  const auto 
+  [viewPosition,              expectedSubdivisions] = GENERATE(values<T>({
+  {vm::vec3d{2, 2,    0},     3u},
+  {vm::vec3d{2, 2,   10},     3u},
+  {vm::vec3d{2, 2,   20},     2u},
+  {vm::vec3d{2, 2,  100},     1u},
+  {vm::vec3d{2, 2, 1000},     0u},
+  }));
+  // clang-format on
+
+  CAPTURE(viewPosition);
+
+  CHECK(selectPatchSubdivisions(bounds, viewPosition) == expectedSubdivisions);
+}
+
+TEST_CASE("PatchNode.selectPatchSubdivisionsWithHysteresis")
+{
+  // the threshold between 3 and 2 subdivisions is at a distance of about 11.3
+  const auto bounds = vm::bbox3d{{0, 0, 0}, {4, 4, 0}};
+
+  using T = std::tuple<vm::vec3d, size_t, size_t>;
+
+  // clang-format off
+  const auto 
+  [viewPosition,          currentSubdivisions, expected] = GENERATE(values<T>({
+  {vm::vec3d{2, 2,    8}, 2u,                  3u},
+  {vm::vec3d{2, 2,   10}, 2u,                  2u},
+  {vm::vec3d{2, 2,   10}, 3u,                  3u},
+  {vm::vec3d{2, 2,   13}, 3u,                  3u},
+  {vm::vec3d{2, 2,   13}, 2u,                  2u},
+  {vm::vec3d{2, 2,   15}, 3u,                  2u},
+  {vm::vec3d{2, 2,   10}, 0u,                  2u},
+  {vm::vec3d{2, 2, 1000}, 3u,                  0u},
+  }));
+  // clang-format on
+
+  CAPTURE(viewPosition, currentSubdivisions);
+
+  CHECK(
+    selectPatchSubdivisions(bounds, viewPosition, currentSubdivisions) == expected);
+}
+
 TEST_CASE("PatchNode.pickFlatPatch")
 {
   using P = BezierPatch::Point;
@@ -351,6 +351,38 @@ TEST_CASE("PolyhedronTest.constructCube")
      {p2, p6, p8, p4}}));
 }
 
+TEST_CASE("PolyhedronTest.constructCubeFromGrid")
+{
+  // most of these points are removed before the hull is built
+  auto points = std::vector<vm::vec3d>{};
+  for (int x = -8; x <= 8; ++x)
+  {
+    for (int y = -8; y <= 8; ++y)
+    {
+      for (int z = -8; z <= 8; ++z)
+      {
+        points.emplace_back(double(x), double(y), double(z));
+      }
+    }
+  }
+
+  const auto p = Polyhedron3d{points};
+
+  CHECK(p.closed());
+  CHECK(p.vertexCount() == 8u);
+  CHECK(p.faceCount() == 6u);
+  CHECK(p.hasAllVertices({
+    {-8, -8, -8},
+    {-8, -8, +8},
+    {-8, +8, -8},
+    {-8, +8, +8},
+    {+8, -8, -8},
+    {+8, -8, +8},
+    {+8, +8, -8},
+    {+8, +8, +8},
+  }));
+}
+
 TEST_CASE("PolyhedronTest.copy")
 {
   const auto p1 = vm::vec3d{0, 0, 8};
@@ -0,0 +1,86 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "render/BrushRendererArrays.h"
+
+#include "Catch2.h"
+
+namespace tb::render
+{
+
+TEST_CASE("DirtyRangeTracker")
+{
+  auto t = DirtyRangeTracker{1000};
+  CHECK(t.capacity() == 1000u);
+  CHECK(t.clean());
+
+  SECTION("markDirty merges adjacent ranges")
+  {
+    t.markDirty(10, 10);
+    t.markDirty(20, 10);
+    CHECK_FALSE(t.clean());
+    CHECK(t.dirtyRanges() == std::vector<DirtyRange>{{10, 20}});
+  }
+
+  SECTION("markDirty merges nearby ranges")
+  {
+    t.markDirty(10, 10);
+    t.markDirty(20 + DirtyRangeTracker::MergeDistance, 10);
+    CHECK(
+      t.dirtyRanges()
+      == std::vector<DirtyRange>{{10, 20 + DirtyRangeTracker::MergeDistance}});
+  }
+
+  SECTION("markDirty keeps distant ranges separate")
+  {
+    t.markDirty(900, 10);
+    t.markDirty(10, 10);
+    t.markDirty(500, 10);
+    CHECK(t.dirtyRanges() == std::vector<DirtyRange>{{10, 10}, {500, 10}, {900, 10}});
+  }
+
+  SECTION("dirtyRanges merges overlapping ranges")
+  {
+    t.markDirty(500, 10);
+    t.markDirty(10, 10);
+    t.markDirty(505, 20);
+    t.markDirty(490, 5);
+    CHECK(t.dirtyRanges() == std::vector<DirtyRange>{{10, 10}, {490, 35}});
+  }
+
+  SECTION("markDirty ignores empty ranges")
+  {
+    t.markDirty(10, 0);
+    CHECK(t.clean());
+  }
+
+  SECTION("markDirty checks bounds")
+  {
+    CHECK_THROWS_AS(t.markDirty(999, 2), std::invalid_argument);
+  }
+
+  SECTION("expand marks the new range as dirty")
+  {
+    t.expand(1500);
+    CHECK(t.capacity() == 1500u);
+    CHECK(t.dirtyRanges() == std::vector<DirtyRange>{{1000, 500}});
+  }
+}
+
+} // namespace tb::render
@@ -0,0 +1,86 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mdl/EntityModel.h"
+#include "render/EntityModelInstances.h"
+#include "render/MaterialIndexRangeRenderer.h"
+
+#include "vm/mat_ext.h"
+
+#include "Catch2.h"
+
+namespace tb::render
+{
+
+TEST_CASE("buildEntityModelInstances")
+{
+  auto renderer1 = MaterialIndexRangeRenderer{};
+  auto renderer2 = MaterialIndexRangeRenderer{};
+
+  const auto t1 = vm::translation_matrix(vm::vec3f{1, 0, 0});
+  const auto t2 = vm::translation_matrix(vm::vec3f{2, 0, 0});
+  const auto t3 = vm::translation_matrix(vm::vec3f{3, 0, 0});
+  const auto t4 = vm::translation_matrix(vm::vec3f{4, 0, 0});
+
+  using mdl::Orientation;
+
+  SECTION("No instances")
+  {
+    const auto instances = buildEntityModelInstances({});
+    CHECK(instances.batches.empty());
+    CHECK(instances.transformations.empty());
+  }
+
+  SECTION("Instances sharing a renderer are batched")
+  {
+    const auto instances = buildEntityModelInstances({
+      {&renderer1, Orientation::Oriented, t1},
+      {&renderer2, Orientation::Oriented, t2},
+      {&renderer1, Orientation::Oriented, t3},
+      {&renderer1, Orientation::Oriented, t4},
+    });
+
+    CHECK(
+      instances.batches
+      == std::vector<EntityModelInstanceBatch>{
+        {&renderer1, Orientation::Oriented, 0, 3},
+        {&renderer2, Orientation::Oriented, 3, 1},
+      });
+    CHECK(instances.transformations == std::vector<vm::mat4x4f>{t1, t3, t4, t2});
+  }
+
+  SECTION("Instances with different orientations are not batched")
+  {
+    const auto instances = buildEntityModelInstances({
+      {&renderer1, Orientation::Oriented, t1},
+      {&renderer1, Orientation::FacingUpright, t2},
+      {&renderer1, Orientation::Oriented, t3},
+    });
+
+    CHECK(
+      instances.batches
+      == std::vector<EntityModelInstanceBatch>{
+        {&renderer1, Orientation::Oriented, 0, 2},
+        {&renderer1, Orientation::FacingUpright, 2, 1},
+      });
+    CHECK(instances.transformations == std::vector<vm::mat4x4f>{t1, t3, t2});
+  }
+}
+
+} // namespace tb::render
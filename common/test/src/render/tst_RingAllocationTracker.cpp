@@ -0,0 +1,124 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ This file is part of TrenchBroom.
+
+ TrenchBroom is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ TrenchBroom is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with TrenchBroom. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "render/RingAllocationTracker.h"
+
+#include "Catch2.h"
+
+namespace tb::render
+{
+
+TEST_CASE("RingAllocationTracker")
+{
+  auto t = RingAllocationTracker{100};
+  CHECK(t.capacity() == 100u);
+  CHECK(t.usedSize() == 0u);
+  CHECK(t.framesInFlight() == 0u);
+
+  SECTION("allocate")
+  {
+    CHECK(t.allocate(10) == 0u);
+    CHECK(t.allocate(20) == 10u);
+    CHECK(t.usedSize() == 30u);
+    CHECK(t.currentFrameSize() == 30u);
+
+    CHECK(t.allocate(71) == std::nullopt);
+    CHECK(t.allocate(70) == 30u);
+    CHECK(t.allocate(1) == std::nullopt);
+    CHECK(t.usedSize() == 100u);
+  }
+
+  SECTION("allocate with alignment")
+  {
+    CHECK(t.allocate(10, 16) == 0u);
+    CHECK(t.allocate(10, 16) == 16u);
+    CHECK(t.usedSize() == 26u);
+
+    CHECK(t.allocate(70, 16) == std::nullopt);
+    CHECK(t.allocate(60, 16) == 32u);
+    CHECK(t.usedSize() == 92u);
+  }
+
+  SECTION("allocate larger than capacity")
+  {
+    CHECK(t.allocate(101) == std::nullopt);
+    CHECK(t.usedSize() == 0u);
+  }
+
+  SECTION("frames stay in use until they are retired")
+  {
+    CHECK(t.allocate(40) == 0u);
+    t.endFrame();
+    CHECK(t.framesInFlight() == 1u);
+    CHECK(t.currentFrameSize() == 0u);
+
+    CHECK(t.allocate(40) == 40u);
+    t.endFrame();
+    CHECK(t.framesInFlight() == 2u);
+
+    CHECK(t.allocate(40) == std::nullopt);
+
+    t.retireFrame();
+    CHECK(t.framesInFlight() == 1u);
+    CHECK(t.usedSize() == 40u);
+
+    // the remaining 20 bytes at the end of the buffer are skipped
+    CHECK(t.allocate(40) == 0u);
+    CHECK(t.usedSize() == 100u);
+    CHECK(t.currentFrameSize() == 60u);
+    t.endFrame();
+
+    t.retireFrame();
+    CHECK(t.usedSize() == 60u);
+
+    CHECK(t.allocate(41) == std::nullopt);
+    CHECK(t.allocate(40) == 40u);
+
+    t.endFrame();
+    t.retireFrame();
+    t.retireFrame();
+    CHECK(t.framesInFlight() == 0u);
+    CHECK(t.usedSize() == 0u);
+    CHECK(t.peakUsedSize() == 100u);
+  }
+
+  SECTION("start over when nothing is in use")
+  {
+    CHECK(t.allocate(60) == 0u);
+    t.endFrame();
+    t.retireFrame();
+
+    CHECK(t.allocate(60) == 0u);
+  }
+
+  SECTION("reset")
+  {
+    CHECK(t.allocate(60) == 0u);
+    t.endFrame();
+    CHECK(t.allocate(30) == 60u);
+
+    t.reset();
+    CHECK(t.framesInFlight() == 0u);
+    CHECK(t.usedSize() == 0u);
+    CHECK(t.currentFrameSize() == 0u);
+    CHECK(t.allocate(100) == 0u);
+  }
+}
+
+} // namespace tb::render
@@ -19,8 +19,12 @@
 
 #include "Macros.h"
 #include "NotifierConnection.h"
+#include "mdl/BrushNode.h"
+#include "mdl/NodeContents.h"
+#include "ui/AddRemoveNodesCommand.h"
 #include "ui/CommandProcessor.h"
 #include "ui/MapDocumentCommandFacade.h"
+#include "ui/MapDocumentTest.h"
 #include "ui/TransactionScope.h"
 #include "ui/UndoableCommand.h"
 
@@ -243,6 +247,21 @@ public:
   }
 };
 
+class SizedCommand : public NullCommand
+{
+private:
+  size_t m_memoryUsage;
+
+public:
+  SizedCommand(std::string name, const size_t memoryUsage)
+    : NullCommand{std::move(name)}
+    , m_memoryUsage{memoryUsage}
+  {
+  }
+
+  size_t memoryUsage() const override { return m_memoryUsage; }
+};
+
 } // namespace
 
 TEST_CASE("CommandProcessorTest.doAndUndoSuccessfulCommand")
@@ -832,4 +851,93 @@ TEST_CASE("CommandProcessorTest.collateTransactions")
   commandProcessor.undo();
 }
 
+TEST_CASE("CommandProcessorTest.undoMemoryBudget")
+{
+  auto facade = MapDocumentCommandFacade{};
+  auto commandProcessor = CommandProcessor{facade};
+  commandProcessor.setUndoMemoryBudget(250);
+
+  commandProcessor.executeAndStore(std::make_unique<SizedCommand>("cmd1", 100));
+  commandProcessor.executeAndStore(std::make_unique<SizedCommand>("cmd2", 100));
+  CHECK(commandProcessor.undoMemoryUsage() == 200);
+
+  SECTION("Oldest commands are discarded when the budget is exceeded")
+  {
+    commandProcessor.executeAndStore(std::make_unique<SizedCommand>("cmd3", 100));
+    CHECK(commandProcessor.undoMemoryUsage() == 200);
+
+    CHECK(commandProcessor.undo()->success());
+    CHECK(commandProcessor.undoMemoryUsage() == 100);
+    CHECK(commandProcessor.undo()->success());
+    CHECK(commandProcessor.undoMemoryUsage() == 0);
+    CHECK_FALSE(commandProcessor.canUndo());
+
+    CHECK(commandProcessor.redo()->success());
+    CHECK(commandProcessor.undoCommandName() == "cmd2");
+    CHECK(commandProcessor.undoMemoryUsage() == 100);
+  }
+
+  SECTION("The most recent command is kept even if it exceeds the budget")
+  {
+    commandProcessor.executeAndStore(std::make_unique<SizedCommand>("cmd3", 1000));
+    CHECK(commandProcessor.undoMemoryUsage() == 1000);
+    CHECK(commandProcessor.undoCommandName() == "cmd3");
+
+    CHECK(commandProcessor.undo()->success());
+    CHECK_FALSE(commandProcessor.canUndo());
+  }
+
+  SECTION("Lowering the budget discards commands")
+  {
+    commandProcessor.setUndoMemoryBudget(100);
+    CHECK(commandProcessor.undoMemoryUsage() == 100);
+    CHECK(commandProcessor.undoCommandName() == "cmd2");
+  }
+
+  SECTION("Transactions count the memory usage of their commands")
+  {
+    commandProcessor.startTransaction("transaction", TransactionScope::Oneshot);
+    commandProcessor.executeAndStore(std::make_unique<SizedCommand>("cmd3", 50));
+    commandProcessor.executeAndStore(std::make_unique<SizedCommand>("cmd4", 50));
+    commandProcessor.commitTransaction();
+
+    // the transaction exceeds the budget together with cmd1 and cmd2
+    CHECK(commandProcessor.undoCommandName() == "transaction");
+    CHECK(commandProcessor.undoMemoryUsage() > 100);
+    CHECK(commandProcessor.undoMemoryUsage() < 200);
+
+    CHECK(commandProcessor.undo()->success());
+    CHECK_FALSE(commandProcessor.canUndo());
+  }
+}
+
+TEST_CASE_METHOD(MapDocumentTest, "CommandProcessorTest.undoMemoryBudgetRemovedNodes")
+{
+  auto& facade = dynamic_cast<MapDocumentCommandFacade&>(*document);
+  auto commandProcessor = CommandProcessor{facade};
+
+  auto* brushNode = createBrushNode();
+  document->addNodes({{document->parentForNodes(), {brushNode}}});
+
+  const auto brushMemoryUsage = mdl::memoryUsage(*brushNode);
+  REQUIRE(brushMemoryUsage > 0);
+
+  commandProcessor.executeAndStore(
+    AddRemoveNodesCommand::remove({{brushNode->parent(), {brushNode}}}));
+  REQUIRE(brushNode->parent() == nullptr);
+
+  // the removed brush is owned by the command
+  const auto removeMemoryUsage = commandProcessor.undoMemoryUsage();
+  CHECK(removeMemoryUsage >= brushMemoryUsage);
+
+  commandProcessor.setUndoMemoryBudget(removeMemoryUsage + 50);
+  commandProcessor.executeAndStore(std::make_unique<SizedCommand>("cmd", 100));
+
+  CHECK(commandProcessor.undoMemoryUsage() == 100);
+  CHECK(commandProcessor.undoCommandName() == "cmd");
+
+  CHECK(commandProcessor.undo()->success());
+  CHECK_FALSE(commandProcessor.canUndo());
+}
+
 } // namespace tb::ui
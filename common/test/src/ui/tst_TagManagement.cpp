@@ -650,6 +650,7 @@ TEST_CASE_METHOD(MapDocumentTest, "TagManagementTest")
     {
       CHECK(face.hasTag(tag));
     }
+    CHECK(brushNodeWithTags->allFacesHaveAnyTagInMask(tag.type()));
 
     auto* brushNodeWithoutTags = createBrushNode("asdf");
     document->addNodes({{document->parentForNodes(), {brushNodeWithoutTags}}});
@@ -658,6 +659,7 @@ TEST_CASE_METHOD(MapDocumentTest, "TagManagementTest")
     {
       CHECK(!face.hasTag(tag));
     }
+    CHECK_FALSE(brushNodeWithoutTags->anyFacesHaveAnyTagInMask(tag.type()));
   }
 
   SECTION("tagRemoveBrushFaceTags")
@@ -671,6 +673,7 @@ TEST_CASE_METHOD(MapDocumentTest, "TagManagementTest")
     {
       CHECK_FALSE(face.hasTag(tag));
     }
+    CHECK_FALSE(brushNodeWithTags->anyFaceHasAnyTag());
   }
 
   SECTION("tagUpdateBrushFaceTags")
@@ -696,6 +699,45 @@ TEST_CASE_METHOD(MapDocumentTest, "TagManagementTest")
     {
       CHECK(!faces[i].hasTag(tag));
     }
+    CHECK(brushNode->anyFacesHaveAnyTagInMask(tag.type()));
+    CHECK_FALSE(brushNode->allFacesHaveAnyTagInMask(tag.type()));
+  }
+
+  SECTION("updateMaterialTagsAfterChangingMaterial")
+  {
+    auto* brushNode = createBrushNode("asdf");
+    document->addNodes({{document->parentForNodes(), {brushNode}}});
+
+    const auto& tag = document->smartTag("material");
+    const auto& parmTag = document->smartTag("surfaceparm_multi");
+
+    const auto faceHandle = mdl::BrushFaceHandle{brushNode, 0u};
+    document->selectBrushFaces({faceHandle});
+
+    // the second change to each material is answered from the material tag cache
+    for (size_t i = 0; i < 2; ++i)
+    {
+      auto request = mdl::ChangeBrushFaceAttributesRequest{};
+      request.setMaterialName("some_material");
+      document->setFaceAttributes(request);
+
+      CHECK(faceHandle.face().material() == materialA);
+      CHECK(faceHandle.face().hasTag(tag));
+      CHECK(faceHandle.face().hasTag(parmTag));
+
+      request.setMaterialName("other_material");
+      document->setFaceAttributes(request);
+
+      CHECK(faceHandle.face().material() == materialB);
+      CHECK_FALSE(faceHandle.face().hasTag(tag));
+      CHECK(faceHandle.face().hasTag(parmTag));
+
+      request.setMaterialName("asdf");
+      document->setFaceAttributes(request);
+
+      CHECK_FALSE(faceHandle.face().hasTag(tag));
+      CHECK_FALSE(faceHandle.face().hasTag(parmTag));
+    }
   }
 }
 
@@ -86,6 +86,10 @@ TEST_CASE_METHOD(UpdateLinkedGroupsHelperTest, "ownership")
   auto* linkedNode =
     static_cast<mdl::GroupNode*>(groupNode->cloneRecursively(document->worldBounds()));
 
+  // add a child to the linked node so that the children of groupNode are replaced
+  // instead of being updated in place
+  linkedNode->addChild(new mdl::EntityNode{mdl::Entity{}});
+
   document->addNodes({{document->parentForNodes(), {groupNode, linkedNode}}});
 
   SECTION("Helper takes ownership of replaced child nodes")
@@ -186,15 +190,15 @@ TEST_CASE_METHOD(UpdateLinkedGroupsHelperTest, "applyLinkedGroupUpdates")
     +-groupNode
       +-brushNode (translated 0 16 0)
     +-linkedGroupNode (translated 32 0 0)
-      +-newLinkedBrushNode (translated 32 16 0)
+      +-linkedBrushNode (translated 32 16 0)
   */
 
-  // changes were propagated
-  REQUIRE(linkedGroupNode->childCount() == 1u);
-  CHECK(linkedBrushNode->parent() == nullptr);
-  auto* newLinkedBrushNode = linkedGroupNode->children().front();
+  // changes were propagated in place
+  CHECK_THAT(
+    linkedGroupNode->children(), Catch::Equals(std::vector<mdl::Node*>{linkedBrushNode}));
+  CHECK(linkedBrushNode->parent() == linkedGroupNode);
   CHECK(
-    newLinkedBrushNode->physicalBounds()
+    linkedBrushNode->physicalBounds()
     == originalBrushBounds.translate(vm::vec3d(32.0, 16.0, 0.0)));
 
   // undo change propagation
@@ -209,13 +213,231 @@ TEST_CASE_METHOD(UpdateLinkedGroupsHelperTest, "applyLinkedGroupUpdates")
       +-linkedBrushNode (translated 32 0 0)
   */
 
-  REQUIRE(linkedGroupNode->childCount() == 1u);
   CHECK_THAT(
     linkedGroupNode->children(), Catch::Equals(std::vector<mdl::Node*>{linkedBrushNode}));
   CHECK(linkedBrushNode->parent() == linkedGroupNode);
   CHECK(
     linkedBrushNode->physicalBounds()
     == originalBrushBounds.translate(vm::vec3d(32.0, 0.0, 0.0)));
+
+  // redo change propagation
+  REQUIRE(
+    helper
+      .applyLinkedGroupUpdates(*static_cast<MapDocumentCommandFacade*>(document.get()))
+      .is_success());
+
+  CHECK_THAT(
+    linkedGroupNode->children(), Catch::Equals(std::vector<mdl::Node*>{linkedBrushNode}));
+  CHECK(linkedBrushNode->parent() == linkedGroupNode);
+  CHECK(
+    linkedBrushNode->physicalBounds()
+    == originalBrushBounds.translate(vm::vec3d(32.0, 16.0, 0.0)));
+}
+
+TEST_CASE_METHOD(UpdateLinkedGroupsHelperTest, "applyLinkedGroupUpdatesReplacesChildren")
+{
+  auto* groupNode = new mdl::GroupNode{mdl::Group{"test"}};
+  setLinkId(*groupNode, "asdf");
+
+  auto* brushNode = createBrushNode();
+  groupNode->addChild(brushNode);
+
+  auto* linkedGroupNode =
+    static_cast<mdl::GroupNode*>(groupNode->cloneRecursively(document->worldBounds()));
+
+  auto expectedChildCount = size_t(0);
+
+  SECTION("Children were added")
+  {
+    groupNode->addChild(createBrushNode());
+    expectedChildCount = 2u;
+  }
+
+  SECTION("Children were removed")
+  {
+    linkedGroupNode->addChild(createBrushNode());
+    expectedChildCount = 1u;
+  }
+
+  const auto originalChildren = linkedGroupNode->children();
+  document->addNodes({{document->parentForNodes(), {groupNode, linkedGroupNode}}});
+
+  auto helper = UpdateLinkedGroupsHelper{{groupNode}};
+  REQUIRE(
+    helper
+      .applyLinkedGroupUpdates(*static_cast<MapDocumentCommandFacade*>(document.get()))
+      .is_success());
+
+  CHECK(linkedGroupNode->childCount() == expectedChildCount);
+  for (const auto* originalChild : originalChildren)
+  {
+    CHECK(originalChild->parent() == nullptr);
+  }
+
+  helper.undoLinkedGroupUpdates(*static_cast<MapDocumentCommandFacade*>(document.get()));
+
+  CHECK_THAT(linkedGroupNode->children(), Catch::Equals(originalChildren));
+  for (const auto* originalChild : originalChildren)
+  {
+    CHECK(originalChild->parent() == linkedGroupNode);
+  }
+}
+
+TEST_CASE_METHOD(
+  UpdateLinkedGroupsHelperTest, "applyLinkedGroupUpdatesReplacesChildrenOfNestedGroups")
+{
+  auto* outerGroupNode = new mdl::GroupNode{mdl::Group{"outerGroupNode"}};
+  setLinkId(*outerGroupNode, "outerGroupNode");
+
+  auto* innerGroupNode = new mdl::GroupNode{mdl::Group{"innerGroupNode"}};
+  setLinkId(*innerGroupNode, "innerGroupNode");
+
+  auto* brushNode = createBrushNode();
+  innerGroupNode->addChild(brushNode);
+  outerGroupNode->addChild(innerGroupNode);
+
+  auto* linkedOuterGroupNode = static_cast<mdl::GroupNode*>(
+    outerGroupNode->cloneRecursively(document->worldBounds()));
+  auto* linkedInnerGroupNode = linkedOuterGroupNode->children().front();
+  auto* linkedBrushNode = linkedInnerGroupNode->children().front();
+
+  document->addNodes(
+    {{document->parentForNodes(), {outerGroupNode, linkedOuterGroupNode}}});
+
+  /*
+  world
+  +-defaultLayer
+    +-outerGroupNode--------+
+      +-innerGroupNode------|-------+
+        +-brushNode         |       |
+    +-linkedOuterGroupNode--+       |
+      +-linkedInnerGroupNode--------+
+        +-linkedBrushNode
+  */
+
+  const auto originalBrushBounds = brushNode->physicalBounds();
+
+  transformNode(
+    *brushNode,
+    vm::translation_matrix(vm::vec3d(0.0, 0.0, 8.0)),
+    document->worldBounds());
+
+  // linkedInnerGroupNode is nested in linkedOuterGroupNode, so their children cannot be
+  // updated in place
+  auto helper = UpdateLinkedGroupsHelper{{outerGroupNode, innerGroupNode}};
+  REQUIRE(
+    helper
+      .applyLinkedGroupUpdates(*static_cast<MapDocumentCommandFacade*>(document.get()))
+      .is_success());
+
+  CHECK(linkedInnerGroupNode->parent() == nullptr);
+  CHECK(linkedBrushNode->parent() == nullptr);
+
+  REQUIRE(linkedOuterGroupNode->childCount() == 1u);
+  auto* newLinkedInnerGroupNode = linkedOuterGroupNode->children().front();
+  REQUIRE(newLinkedInnerGroupNode->childCount() == 1u);
+  CHECK(
+    newLinkedInnerGroupNode->children().front()->physicalBounds()
+    == originalBrushBounds.translate(vm::vec3d(0.0, 0.0, 8.0)));
+
+  helper.undoLinkedGroupUpdates(*static_cast<MapDocumentCommandFacade*>(document.get()));
+
+  CHECK_THAT(
+    linkedOuterGroupNode->children(),
+    Catch::Equals(std::vector<mdl::Node*>{linkedInnerGroupNode}));
+  CHECK_THAT(
+    linkedInnerGroupNode->children(),
+    Catch::Equals(std::vector<mdl::Node*>{linkedBrushNode}));
+  CHECK(linkedBrushNode->physicalBounds() == originalBrushBounds);
+}
+
+TEST_CASE_METHOD(UpdateLinkedGroupsHelperTest, "collateWith")
+{
+  auto* groupNode = new mdl::GroupNode{mdl::Group{"test"}};
+  setLinkId(*groupNode, "asdf");
+
+  auto* brushNode = createBrushNode();
+  groupNode->addChild(brushNode);
+
+  auto* linkedGroupNode =
+    static_cast<mdl::GroupNode*>(groupNode->cloneRecursively(document->worldBounds()));
+  auto* linkedBrushNode = linkedGroupNode->children().front();
+
+  document->addNodes({{document->parentForNodes(), {groupNode, linkedGroupNode}}});
+
+  const auto originalBrushBounds = brushNode->physicalBounds();
+
+  // changing the brush allows updating linked groups in place
+  const auto translateBrush = [&]() {
+    transformNode(
+      *brushNode,
+      vm::translation_matrix(vm::vec3d(0.0, 16.0, 0.0)),
+      document->worldBounds());
+  };
+
+  // adding a brush requires replacing the children of linked groups
+  const auto addBrush = [&]() { groupNode->addChild(createBrushNode()); };
+
+  const auto applyLinkedGroupUpdates = [&](UpdateLinkedGroupsHelper& helper) {
+    return helper
+      .applyLinkedGroupUpdates(*static_cast<MapDocumentCommandFacade*>(document.get()))
+      .is_success();
+  };
+
+  auto helper1 = UpdateLinkedGroupsHelper{{groupNode}};
+  auto helper2 = UpdateLinkedGroupsHelper{{groupNode}};
+
+  SECTION("Replace children, then update in place")
+  {
+    addBrush();
+    REQUIRE(applyLinkedGroupUpdates(helper1));
+    REQUIRE(linkedGroupNode->childCount() == 2u);
+    REQUIRE(linkedBrushNode->parent() == nullptr);
+
+    auto* newLinkedBrushNode = linkedGroupNode->children().front();
+
+    translateBrush();
+    REQUIRE(applyLinkedGroupUpdates(helper2));
+    REQUIRE(linkedGroupNode->childCount() == 2u);
+    REQUIRE(linkedGroupNode->children().front() == newLinkedBrushNode);
+  }
+
+  SECTION("Update in place, then replace children")
+  {
+    translateBrush();
+    REQUIRE(applyLinkedGroupUpdates(helper1));
+    REQUIRE_THAT(
+      linkedGroupNode->children(),
+      Catch::Equals(std::vector<mdl::Node*>{linkedBrushNode}));
+
+    addBrush();
+    REQUIRE(applyLinkedGroupUpdates(helper2));
+    REQUIRE(linkedGroupNode->childCount() == 2u);
+    REQUIRE(linkedBrushNode->parent() == nullptr);
+  }
+
+  REQUIRE(
+    linkedGroupNode->children().front()->physicalBounds()
+    == originalBrushBounds.translate(vm::vec3d(0.0, 16.0, 0.0)));
+
+  helper1.collateWith(helper2);
+
+  // undoing the collated updates restores the original children and their contents
+  helper1.undoLinkedGroupUpdates(*static_cast<MapDocumentCommandFacade*>(document.get()));
+
+  CHECK_THAT(
+    linkedGroupNode->children(), Catch::Equals(std::vector<mdl::Node*>{linkedBrushNode}));
+  CHECK(linkedBrushNode->parent() == linkedGroupNode);
+  CHECK(linkedBrushNode->physicalBounds() == originalBrushBounds);
+
+  // redoing the collated updates restores the state after both updates
+  REQUIRE(applyLinkedGroupUpdates(helper1));
+
+  CHECK(linkedGroupNode->childCount() == 2u);
+  CHECK(linkedBrushNode->parent() == nullptr);
+  CHECK(
+    linkedGroupNode->children().front()->physicalBounds()
+    == originalBrushBounds.translate(vm::vec3d(0.0, 16.0, 0.0)));
 }
 
 static void setGroupName(mdl::GroupNode& groupNode, const std::string& name)
@@ -0,0 +1,752 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ software and associated documentation files (the "Software"), to deal in the Software
+ without restriction, including without limitation the rights to use, copy, modify, merge,
+ publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+#include "vm/bbox.h"
+#include "vm/constants.h"
+#include "vm/mat.h"
+#include "vm/plane.h"
+#include "vm/ray.h"
+#include "vm/scalar.h"
+#include "vm/vec.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+// The instruction set is selected at compile time. SSE2 and NEON are part of the baseline
+// of x86-64 and AArch64, respectively, so they are always available there. AVX is only
+// used if the compiler is allowed to emit it, e.g. with -mavx or /arch:AVX.
+#if defined(__AVX__)
+#define VM_BATCH_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VM_BATCH_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define VM_BATCH_NEON
+#include <arm_neon.h>
+#endif
+
+namespace vm
+{
+/**
+ * A sequence of 3D points stored as a structure of arrays, that is, with one array per
+ * component. This layout allows the batch functions below to process several points at
+ * once using SIMD instructions.
+ *
+ * @tparam T the component type
+ */
+template <typename T>
+class point_batch
+{
+public:
+  using component_type = T;
+
+  std::vector<T> x;
+  std::vector<T> y;
+  std::vector<T> z;
+
+public:
+  /**
+   * Creates a new empty batch.
+   */
+  point_batch() = default;
+
+  /**
+   * Creates a new batch containing the given points.
+   *
+   * @param points the points
+   */
+  explicit point_batch(const std::vector<vec<T, 3>>& points)
+    : point_batch(points.begin(), points.end())
+  {
+  }
+
+  /**
+   * Creates a new batch containing the points in the given range.
+   *
+   * @tparam I the range iterator type
+   * @tparam G type of the transformation
+   * @param cur the start of the range
+   * @param end the end of the range
+   * @param get the transformation that maps a range element to a vec<T,3>
+   */
+  template <typename I, typename G = identity>
+  point_batch(I cur, I end, const G& get = G())
+  {
+    for (; cur != end; ++cur)
+    {
+      push_back(get(*cur));
+    }
+  }
+
+  /**
+   * Returns the number of points in this batch.
+   */
+  size_t size() const { return x.size(); }
+
+  /**
+   * Indicates whether this batch is empty.
+   */
+  bool empty() const { return x.empty(); }
+
+  /**
+   * Reserves space for the given number of points.
+   *
+   * @param capacity the number of points
+   */
+  void reserve(const size_t capacity)
+  {
+    x.reserve(capacity);
+    y.reserve(capacity);
+    z.reserve(capacity);
+  }
+
+  /**
+   * Appends the given point to this batch.
+   *
+   * @param point the point to append
+   */
+  void push_back(const vec<T, 3>& point)
+  {
+    x.push_back(point.x());
+    y.push_back(point.y());
+    z.push_back(point.z());
+  }
+
+  /**
+   * Returns the point at the given index.
+   *
+   * @param i the index of the point, must be less than the size of this batch
+   * @return the point
+   */
+  vec<T, 3> operator[](const size_t i) const
+  {
+    assert(i < size());
+    return vec<T, 3>{x[i], y[i], z[i]};
+  }
+};
+
+using point_batchf = point_batch<float>;
+using point_batchd = point_batch<double>;
+
+namespace detail
+{
+/**
+ * Lane operations on plain scalars. These are used for the elements that remain after
+ * the SIMD lanes have been processed, and as the fallback if no SIMD instruction set is
+ * available.
+ */
+template <typename T>
+struct scalar_lanes
+{
+  using type = T;
+  using mask = bool;
+  static constexpr size_t width = 1;
+
+  static type load(const T* p) { return *p; }
+  static void store(T* p, const type a) { *p = a; }
+  static type broadcast(const T a) { return a; }
+
+  static type add(const type a, const type b) { return a + b; }
+  static type sub(const type a, const type b) { return a - b; }
+  static type mul(const type a, const type b) { return a * b; }
+  static type div(const type a, const type b) { return a / b; }
+  static type min(const type a, const type b) { return b < a ? b : a; }
+  static type max(const type a, const type b) { return a < b ? b : a; }
+
+  static mask less(const type a, const type b) { return a < b; }
+  static mask greater(const type a, const type b) { return a > b; }
+  static mask greater_equal(const type a, const type b) { return a >= b; }
+  static mask less_equal(const type a, const type b) { return a <= b; }
+  static mask and_mask(const mask a, const mask b) { return a && b; }
+  static mask or_mask(const mask a, const mask b) { return a || b; }
+  static type select(const mask m, const type a, const type b) { return m ? a : b; }
+};
+
+/**
+ * Lane operations using the best available SIMD instruction set. Falls back to scalar
+ * operations if there is none.
+ */
+template <typename T>
+struct simd_lanes : scalar_lanes<T>
+{
+};
+
+#if defined(VM_BATCH_AVX)
+
+template <>
+struct simd_lanes<float>
+{
+  using type = __m256;
+  using mask = __m256;
+  static constexpr size_t width = 8;
+
+  static type load(const float* p) { return _mm256_loadu_ps(p); }
+  static void store(float* p, const type a) { _mm256_storeu_ps(p, a); }
+  static type broadcast(const float a) { return _mm256_set1_ps(a); }
+
+  static type add(const type a, const type b) { return _mm256_add_ps(a, b); }
+  static type sub(const type a, const type b) { return _mm256_sub_ps(a, b); }
+  static type mul(const type a, const type b) { return _mm256_mul_ps(a, b); }
+  static type div(const type a, const type b) { return _mm256_div_ps(a, b); }
+  static type min(const type a, const type b) { return _mm256_min_ps(a, b); }
+  static type max(const type a, const type b) { return _mm256_max_ps(a, b); }
+
+  static mask less(const type a, const type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static mask greater(const type a, const type b)
+  {
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+  }
+  static mask greater_equal(const type a, const type b)
+  {
+    return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+  }
+  static mask less_equal(const type a, const type b)
+  {
+    return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+  }
+  static mask and_mask(const mask a, const mask b) { return _mm256_and_ps(a, b); }
+  static mask or_mask(const mask a, const mask b) { return _mm256_or_ps(a, b); }
+  static type select(const mask m, const type a, const type b)
+  {
+    return _mm256_blendv_ps(b, a, m);
+  }
+};
+
+template <>
+struct simd_lanes<double>
+{
+  using type = __m256d;
+  using mask = __m256d;
+  static constexpr size_t width = 4;
+
+  static type load(const double* p) { return _mm256_loadu_pd(p); }
+  static void store(double* p, const type a) { _mm256_storeu_pd(p, a); }
+  static type broadcast(const double a) { return _mm256_set1_pd(a); }
+
+  static type add(const type a, const type b) { return _mm256_add_pd(a, b); }
+  static type sub(const type a, const type b) { return _mm256_sub_pd(a, b); }
+  static type mul(const type a, const type b) { return _mm256_mul_pd(a, b); }
+  static type div(const type a, const type b) { return _mm256_div_pd(a, b); }
+  static type min(const type a, const type b) { return _mm256_min_pd(a, b); }
+  static type max(const type a, const type b) { return _mm256_max_pd(a, b); }
+
+  static mask less(const type a, const type b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+  static mask greater(const type a, const type b)
+  {
+    return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+  }
+  static mask greater_equal(const type a, const type b)
+  {
+    return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+  }
+  static mask less_equal(const type a, const type b)
+  {
+    return _mm256_cmp_pd(a, b, _CMP_LE_OQ);
+  }
+  static mask and_mask(const mask a, const mask b) { return _mm256_and_pd(a, b); }
+  static mask or_mask(const mask a, const mask b) { return _mm256_or_pd(a, b); }
+  static type select(const mask m, const type a, const type b)
+  {
+    return _mm256_blendv_pd(b, a, m);
+  }
+};
+
+#elif defined(VM_BATCH_SSE2)
+
+template <>
+struct simd_lanes<float>
+{
+  using type = __m128;
+  using mask = __m128;
+  static constexpr size_t width = 4;
+
+  static type load(const float* p) { return _mm_loadu_ps(p); }
+  static void store(float* p, const type a) { _mm_storeu_ps(p, a); }
+  static type broadcast(const float a) { return _mm_set1_ps(a); }
+
+  static type add(const type a, const type b) { return _mm_add_ps(a, b); }
+  static type sub(const type a, const type b) { return _mm_sub_ps(a, b); }
+  static type mul(const type a, const type b) { return _mm_mul_ps(a, b); }
+  static type div(const type a, const type b) { return _mm_div_ps(a, b); }
+  static type min(const type a, const type b) { return _mm_min_ps(a, b); }
+  static type max(const type a, const type b) { return _mm_max_ps(a, b); }
+
+  static mask less(const type a, const type b) { return _mm_cmplt_ps(a, b); }
+  static mask greater(const type a, const type b) { return _mm_cmpgt_ps(a, b); }
+  static mask greater_equal(const type a, const type b) { return _mm_cmpge_ps(a, b); }
+  static mask less_equal(const type a, const type b) { return _mm_cmple_ps(a, b); }
+  static mask and_mask(const mask a, const mask b) { return _mm_and_ps(a, b); }
+  static mask or_mask(const mask a, const mask b) { return _mm_or_ps(a, b); }
+  static type select(const mask m, const type a, const type b)
+  {
+    return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+  }
+};
+
+template <>
+struct simd_lanes<double>
+{
+  using type = __m128d;
+  using mask = __m128d;
+  static constexpr size_t width = 2;
+
+  static type load(const double* p) { return _mm_loadu_pd(p); }
+  static void store(double* p, const type a) { _mm_storeu_pd(p, a); }
+  static type broadcast(const double a) { return _mm_set1_pd(a); }
+
+  static type add(const type a, const type b) { return _mm_add_pd(a, b); }
+  static type sub(const type a, const type b) { return _mm_sub_pd(a, b); }
+  static type mul(const type a, const type b) { return _mm_mul_pd(a, b); }
+  static type div(const type a, const type b) { return _mm_div_pd(a, b); }
+  static type min(const type a, const type b) { return _mm_min_pd(a, b); }
+  static type max(const type a, const type b) { return _mm_max_pd(a, b); }
+
+  static mask less(const type a, const type b) { return _mm_cmplt_pd(a, b); }
+  static mask greater(const type a, const type b) { return _mm_cmpgt_pd(a, b); }
+  static mask greater_equal(const type a, const type b) { return _mm_cmpge_pd(a, b); }
+  static mask less_equal(const type a, const type b) { return _mm_cmple_pd(a, b); }
+  static mask and_mask(const mask a, const mask b) { return _mm_and_pd(a, b); }
+  static mask or_mask(const mask a, const mask b) { return _mm_or_pd(a, b); }
+  static type select(const mask m, const type a, const type b)
+  {
+    return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));
+  }
+};
+
+#elif defined(VM_BATCH_NEON)
+
+template <>
+struct simd_lanes<float>
+{
+  using type = float32x4_t;
+  using mask = uint32x4_t;
+  static constexpr size_t width = 4;
+
+  static type load(const float* p) { return vld1q_f32(p); }
+  static void store(float* p, const type a) { vst1q_f32(p, a); }
+  static type broadcast(const float a) { return vdupq_n_f32(a); }
+
+  static type add(const type a, const type b) { return vaddq_f32(a, b); }
+  static type sub(const type a, const type b) { return vsubq_f32(a, b); }
+  static type mul(const type a, const type b) { return vmulq_f32(a, b); }
+  static type div(const type a, const type b) { return vdivq_f32(a, b); }
+  static type min(const type a, const type b) { return vminq_f32(a, b); }
+  static type max(const type a, const type b) { return vmaxq_f32(a, b); }
+
+  static mask less(const type a, const type b) { return vcltq_f32(a, b); }
+  static mask greater(const type a, const type b) { return vcgtq_f32(a, b); }
+  static mask greater_equal(const type a, const type b) { return vcgeq_f32(a, b); }
+  static mask less_equal(const type a, const type b) { return vcleq_f32(a, b); }
+  static mask and_mask(const mask a, const mask b) { return vandq_u32(a, b); }
+  static mask or_mask(const mask a, const mask b) { return vorrq_u32(a, b); }
+  static type select(const mask m, const type a, const type b)
+  {
+    return vbslq_f32(m, a, b);
+  }
+};
+
+template <>
+struct simd_lanes<double>
+{
+  using type = float64x2_t;
+  using mask = uint64x2_t;
+  static constexpr size_t width = 2;
+
+  static type load(const double* p) { return vld1q_f64(p); }
+  static void store(double* p, const type a) { vst1q_f64(p, a); }
+  static type broadcast(const double a) { return vdupq_n_f64(a); }
+
+  static type add(const type a, const type b) { return vaddq_f64(a, b); }
+  static type sub(const type a, const type b) { return vsubq_f64(a, b); }
+  static type mul(const type a, const type b) { return vmulq_f64(a, b); }
+  static type div(const type a, const type b) { return vdivq_f64(a, b); }
+  static type min(const type a, const type b) { return vminq_f64(a, b); }
+  static type max(const type a, const type b) { return vmaxq_f64(a, b); }
+
+  static mask less(const type a, const type b) { return vcltq_f64(a, b); }
+  static mask greater(const type a, const type b) { return vcgtq_f64(a, b); }
+  static mask greater_equal(const type a, const type b) { return vcgeq_f64(a, b); }
+  static mask less_equal(const type a, const type b) { return vcleq_f64(a, b); }
+  static mask and_mask(const mask a, const mask b) { return vandq_u64(a, b); }
+  static mask or_mask(const mask a, const mask b) { return vorrq_u64(a, b); }
+  static type select(const mask m, const type a, const type b)
+  {
+    return vbslq_f64(m, a, b);
+  }
+};
+
+#endif
+
+/**
+ * Calls the given kernel for every element index in [0, count). The kernel is a generic
+ * lambda whose template parameter is the lane operations type. It is called with
+ * simd_lanes<T> for as many elements as possible, and with scalar_lanes<T> for the
+ * remaining elements.
+ */
+template <typename T, typename K>
+void for_each_lane(const size_t count, const K& kernel)
+{
+  using simd = simd_lanes<T>;
+  using scalar = scalar_lanes<T>;
+
+  auto i = size_t(0);
+  if constexpr (simd::width > 1)
+  {
+    for (; i + simd::width <= count; i += simd::width)
+    {
+      kernel.template operator()<simd>(i);
+    }
+  }
+  for (; i < count; ++i)
+  {
+    kernel.template operator()<scalar>(i);
+  }
+}
+
+template <typename L>
+struct lane_vec3
+{
+  typename L::type x;
+  typename L::type y;
+  typename L::type z;
+};
+
+template <typename L, typename T>
+lane_vec3<L> load_vec3(const point_batch<T>& points, const size_t i)
+{
+  return {
+    L::load(points.x.data() + i),
+    L::load(points.y.data() + i),
+    L::load(points.z.data() + i)};
+}
+
+template <typename L, typename T>
+lane_vec3<L> broadcast_vec3(const vec<T, 3>& v)
+{
+  return {L::broadcast(v.x()), L::broadcast(v.y()), L::broadcast(v.z())};
+}
+
+template <typename L>
+lane_vec3<L> sub_vec3(const lane_vec3<L>& lhs, const lane_vec3<L>& rhs)
+{
+  return {L::sub(lhs.x, rhs.x), L::sub(lhs.y, rhs.y), L::sub(lhs.z, rhs.z)};
+}
+
+template <typename L>
+typename L::type dot_vec3(const lane_vec3<L>& lhs, const lane_vec3<L>& rhs)
+{
+  return L::add(
+    L::add(L::mul(lhs.x, rhs.x), L::mul(lhs.y, rhs.y)), L::mul(lhs.z, rhs.z));
+}
+
+template <typename L>
+lane_vec3<L> cross_vec3(const lane_vec3<L>& lhs, const lane_vec3<L>& rhs)
+{
+  return {
+    L::sub(L::mul(lhs.y, rhs.z), L::mul(lhs.z, rhs.y)),
+    L::sub(L::mul(lhs.z, rhs.x), L::mul(lhs.x, rhs.z)),
+    L::sub(L::mul(lhs.x, rhs.y), L::mul(lhs.y, rhs.x))};
+}
+
+} // namespace detail
+
+/**
+ * Computes the distances of the given points to the given plane. The sign of a distance
+ * indicates whether the point is above or below the plane.
+ *
+ * The result is the same as calling plane::point_distance for every point. It is written
+ * to the given vector, which is resized to the number of points. Reusing the vector for
+ * several calls avoids allocating memory for every call.
+ *
+ * @tparam T the component type
+ * @param p the plane
+ * @param points the points
+ * @param result the vector to store the distances in, in the order of the given points
+ */
+template <typename T>
+void point_distances(
+  const plane<T, 3>& p, const point_batch<T>& points, std::vector<T>& result)
+{
+  result.resize(points.size());
+  detail::for_each_lane<T>(points.size(), [&]<typename L>(const size_t i) {
+    const auto dist = L::sub(
+      detail::dot_vec3<L>(
+        detail::load_vec3<L>(points, i), detail::broadcast_vec3<L>(p.normal)),
+      L::broadcast(p.distance));
+    L::store(result.data() + i, dist);
+  });
+}
+
+/**
+ * Computes the distances of the given points to the given plane. The sign of a distance
+ * indicates whether the point is above or below the plane.
+ *
+ * The result is the same as calling plane::point_distance for every point.
+ *
+ * @tparam T the component type
+ * @param p the plane
+ * @param points the points
+ * @return the distances, in the order of the given points
+ */
+template <typename T>
+std::vector<T> point_distances(const plane<T, 3>& p, const point_batch<T>& points)
+{
+  auto result = std::vector<T>{};
+  point_distances(p, points, result);
+  return result;
+}
+
+/**
+ * Determines the relative positions of the given points to the given plane.
+ *
+ * The result is the same as calling plane::point_status for every point.
+ *
+ * @tparam T the component type
+ * @param p the plane
+ * @param points the points
+ * @param epsilon an epsilon value (the maximum absolute distance up to which a point
+ * will be considered to be inside)
+ * @return the point statuses, in the order of the given points
+ */
+template <typename T>
+std::vector<plane_status> point_statuses(
+  const plane<T, 3>& p,
+  const point_batch<T>& points,
+  const T epsilon = constants<T>::point_status_epsilon())
+{
+  const auto distances = point_distances(p, points);
+
+  auto result = std::vector<plane_status>(distances.size());
+  std::transform(
+    distances.begin(), distances.end(), result.begin(), [&](const auto dist) {
+      return dist > epsilon    ? plane_status::above
+             : dist < -epsilon ? plane_status::below
+                               : plane_status::inside;
+    });
+  return result;
+}
+
+/**
+ * Multiplies the given points by the given matrix.
+ *
+ * The result is the same as multiplying every point by the given matrix, that is, the
+ * points are converted to homogeneous coordinates and back. It is written to the given
+ * batch, which is resized to the number of points. Reusing the batch for several calls
+ * avoids allocating memory for every call.
+ *
+ * @tparam T the component type
+ * @param m the matrix
+ * @param points the points
+ * @param result the batch to store the transformed points in, in the order of the given
+ * points
+ */
+template <typename T>
+void transform(
+  const mat<T, 4, 4>& m, const point_batch<T>& points, point_batch<T>& result)
+{
+  result.x.resize(points.size());
+  result.y.resize(points.size());
+  result.z.resize(points.size());
+
+  detail::for_each_lane<T>(points.size(), [&]<typename L>(const size_t i) {
+    const auto p = detail::load_vec3<L>(points, i);
+    const auto row = [&](const size_t r) {
+      return L::add(
+        L::add(
+          L::add(L::mul(L::broadcast(m[0][r]), p.x), L::mul(L::broadcast(m[1][r]), p.y)),
+          L::mul(L::broadcast(m[2][r]), p.z)),
+        L::broadcast(m[3][r]));
+    };
+
+    const auto w = row(3);
+    L::store(result.x.data() + i, L::div(row(0), w));
+    L::store(result.y.data() + i, L::div(row(1), w));
+    L::store(result.z.data() + i, L::div(row(2), w));
+  });
+}
+
+/**
+ * Multiplies the given points by the given matrix.
+ *
+ * The result is the same as multiplying every point by the given matrix, that is, the
+ * points are converted to homogeneous coordinates and back.
+ *
+ * @tparam T the component type
+ * @param m the matrix
+ * @param points the points
+ * @return the transformed points, in the order of the given points
+ */
+template <typename T>
+point_batch<T> operator*(const mat<T, 4, 4>& m, const point_batch<T>& points)
+{
+  auto result = point_batch<T>{};
+  transform(m, points, result);
+  return result;
+}
+
+#ifdef _MSC_VER
+// MSVC complains about a potential divide by zero every time we divide by a, but the
+// affected lanes are discarded.
+#pragma warning(push)
+#pragma warning(disable : 4723)
+#endif
+
+/**
+ * Computes the closest point of intersection of the given ray and the given triangles.
+ * The i-th triangle has the vertices p1[i], p2[i] and p3[i].
+ *
+ * For every triangle, the result is the same as calling intersect_ray_triangle.
+ *
+ * @tparam T the component type
+ * @param r the ray
+ * @param p1 the first vertices of the triangles
+ * @param p2 the second vertices of the triangles
+ * @param p3 the third vertices of the triangles
+ * @return the distance to the closest point of intersection and the index of the
+ * intersected triangle, or nullopt if the given ray does not intersect any triangle
+ */
+template <typename T>
+std::optional<std::tuple<T, size_t>> intersect_ray_triangles(
+  const ray<T, 3>& r,
+  const point_batch<T>& p1,
+  const point_batch<T>& p2,
+  const point_batch<T>& p3)
+{
+  assert(p1.size() == p2.size() && p1.size() == p3.size());
+
+  auto distances = std::vector<T>(p1.size());
+  detail::for_each_lane<T>(p1.size(), [&]<typename L>(const size_t i) {
+    const auto epsilon = L::broadcast(constants<T>::almost_zero());
+    const auto minusEpsilon = L::broadcast(-constants<T>::almost_zero());
+
+    const auto o = detail::broadcast_vec3<L>(r.origin);
+    const auto d = detail::broadcast_vec3<L>(r.direction);
+    const auto v1 = detail::load_vec3<L>(p1, i);
+    const auto e1 = detail::sub_vec3<L>(detail::load_vec3<L>(p2, i), v1);
+    const auto e2 = detail::sub_vec3<L>(detail::load_vec3<L>(p3, i), v1);
+    const auto p = detail::cross_vec3<L>(d, e2);
+    const auto a = detail::dot_vec3<L>(p, e1);
+
+    const auto t = detail::sub_vec3<L>(o, v1);
+    const auto q = detail::cross_vec3<L>(t, e1);
+
+    const auto u = L::div(detail::dot_vec3<L>(q, e2), a);
+    const auto v = L::div(detail::dot_vec3<L>(p, t), a);
+    const auto w = L::div(detail::dot_vec3<L>(q, d), a);
+
+    const auto hit = L::and_mask(
+      L::and_mask(
+        L::or_mask(L::greater(a, epsilon), L::less(a, minusEpsilon)),
+        L::greater_equal(u, minusEpsilon)),
+      L::and_mask(
+        L::and_mask(L::greater_equal(v, minusEpsilon), L::greater_equal(w, minusEpsilon)),
+        L::less_equal(L::sub(L::add(v, w), L::broadcast(T(1))), epsilon)));
+
+    L::store(
+      distances.data() + i,
+      L::select(hit, u, L::broadcast(std::numeric_limits<T>::infinity())));
+  });
+
+  const auto closest = std::min_element(distances.begin(), distances.end());
+  if (closest == distances.end() || is_inf(*closest))
+  {
+    return std::nullopt;
+  }
+  return std::tuple{*closest, size_t(closest - distances.begin())};
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+/**
+ * Computes the smallest bounding box that contains the given points.
+ *
+ * @tparam T the component type
+ * @param points the points, must not be empty
+ * @return the bounding box
+ */
+template <typename T>
+bbox<T, 3> bounds(const point_batch<T>& points)
+{
+  assert(!points.empty());
+
+  using simd = detail::simd_lanes<T>;
+  using scalar = detail::scalar_lanes<T>;
+
+  auto min = points[0];
+  auto max = points[0];
+
+  auto i = size_t(0);
+  if constexpr (simd::width > 1)
+  {
+    if (points.size() >= simd::width)
+    {
+      auto laneMin = detail::load_vec3<simd>(points, 0);
+      auto laneMax = laneMin;
+      for (i = simd::width; i + simd::width <= points.size(); i += simd::width)
+      {
+        const auto p = detail::load_vec3<simd>(points, i);
+        laneMin = {
+          simd::min(laneMin.x, p.x),
+          simd::min(laneMin.y, p.y),
+          simd::min(laneMin.z, p.z)};
+        laneMax = {
+          simd::max(laneMax.x, p.x),
+          simd::max(laneMax.y, p.y),
+          simd::max(laneMax.z, p.z)};
+      }
+
+      T lanes[6][simd::width];
+      simd::store(lanes[0], laneMin.x);
+      simd::store(lanes[1], laneMin.y);
+      simd::store(lanes[2], laneMin.z);
+      simd::store(lanes[3], laneMax.x);
+      simd::store(lanes[4], laneMax.y);
+      simd::store(lanes[5], laneMax.z);
+      for (size_t j = 0; j < simd::width; ++j)
+      {
+        min = vm::min(min, vec<T, 3>{lanes[0][j], lanes[1][j], lanes[2][j]});
+        max = vm::max(max, vec<T, 3>{lanes[3][j], lanes[4][j], lanes[5][j]});
+      }
+    }
+  }
+
+  for (; i < points.size(); ++i)
+  {
+    const auto p = detail::load_vec3<scalar>(points, i);
+    min = vec<T, 3>{
+      scalar::min(min.x(), p.x), scalar::min(min.y(), p.y), scalar::min(min.z(), p.z)};
+    max = vec<T, 3>{
+      scalar::max(max.x(), p.x), scalar::max(max.y(), p.y), scalar::max(max.z(), p.z)};
+  }
+
+  return bbox<T, 3>{min, max};
+}
+
+} // namespace vm
@@ -0,0 +1,215 @@
+/*
+ Copyright (C) 2025 Kristian Duske
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this
+ software and associated documentation files (the "Software"), to deal in the Software
+ without restriction, including without limitation the rights to use, copy, modify, merge,
+ publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+ persons to whom the Software is furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all copies or
+ substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+ INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+ PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ DEALINGS IN THE SOFTWARE.
+*/
+
+#include "vm/approx.h"
+#include "vm/batch.h"
+#include "vm/bbox.h"
+#include "vm/intersection.h"
+#include "vm/mat.h"
+#include "vm/mat_ext.h"
+#include "vm/plane.h"
+#include "vm/ray.h"
+#include "vm/vec.h"
+
+#include <cmath>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "catch2.h"
+
+namespace vm
+{
+namespace
+{
+
+template <typename T>
+std::vector<vec<T, 3>> make_points(const size_t count, const T offset = T(0))
+{
+  auto result = std::vector<vec<T, 3>>{};
+  for (size_t i = 0; i < count; ++i)
+  {
+    const auto t = T(i) + offset;
+    result.push_back(vec<T, 3>{
+      T(100) * std::sin(t), T(100) * std::cos(T(1.3) * t), T(0.5) * t - T(10)});
+  }
+  return result;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("batch.point_batch", "", float, double)
+{
+  const auto points = make_points<TestType>(5);
+  const auto batch = point_batch<TestType>{points};
+
+  CHECK(batch.size() == 5u);
+  CHECK_FALSE(batch.empty());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    CHECK(batch[i] == points[i]);
+  }
+
+  CHECK(point_batch<TestType>{}.empty());
+}
+
+TEMPLATE_TEST_CASE("batch.point_distances", "", float, double)
+{
+  const auto count = GENERATE(size_t(0), size_t(1), size_t(3), size_t(8), size_t(37));
+  const auto points = make_points<TestType>(count);
+  const auto p = plane<TestType, 3>{TestType(3), normalize(vec<TestType, 3>{1, 2, 3})};
+
+  const auto distances = point_distances(p, point_batch<TestType>{points});
+  REQUIRE(distances.size() == count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    CHECK(distances[i] == approx(p.point_distance(points[i])));
+  }
+
+  auto reusedDistances = std::vector<TestType>(64, TestType(-1));
+  point_distances(p, point_batch<TestType>{points}, reusedDistances);
+  CHECK(reusedDistances == distances);
+}
+
+TEMPLATE_TEST_CASE("batch.point_statuses", "", float, double)
+{
+  const auto p = plane<TestType, 3>{TestType(1), vec<TestType, 3>{0, 0, 1}};
+  const auto points = std::vector<vec<TestType, 3>>{
+    {0, 0, 2},
+    {0, 0, 0},
+    {0, 0, 1},
+    {5, 5, 1},
+    {1, 2, -3},
+    {0, 0, 1.00001},
+    {7, 0, 3},
+    {0, 7, -1},
+    {1, 1, 1},
+  };
+
+  const auto statuses = point_statuses(p, point_batch<TestType>{points});
+  REQUIRE(statuses.size() == points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    CHECK(statuses[i] == p.point_status(points[i]));
+  }
+}
+
+TEMPLATE_TEST_CASE("batch.transform", "", float, double)
+{
+  const auto count = GENERATE(size_t(0), size_t(1), size_t(3), size_t(8), size_t(37));
+  const auto points = make_points<TestType>(count);
+  const auto m = translation_matrix(vec<TestType, 3>{1, -2, 3})
+                 * rotation_matrix(vec<TestType, 3>{0, 0, 1}, TestType(0.5))
+                 * scaling_matrix(vec<TestType, 3>{2, 2, 1});
+
+  const auto transformed = m * point_batch<TestType>{points};
+  REQUIRE(transformed.size() == count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    CHECK(transformed[i] == approx(m * points[i]));
+  }
+
+  auto reusedBatch = point_batch<TestType>{make_points<TestType>(64)};
+  transform(m, point_batch<TestType>{points}, reusedBatch);
+  CHECK(reusedBatch.x == transformed.x);
+  CHECK(reusedBatch.y == transformed.y);
+  CHECK(reusedBatch.z == transformed.z);
+}
+
+TEMPLATE_TEST_CASE("batch.intersect_ray_triangles", "", float, double)
+{
+  using vec3 = vec<TestType, 3>;
+
+  // a row of unit triangles in the XY plane at increasing heights
+  auto p1 = point_batch<TestType>{};
+  auto p2 = point_batch<TestType>{};
+  auto p3 = point_batch<TestType>{};
+  for (size_t i = 0; i < 11; ++i)
+  {
+    const auto x = TestType(i) * TestType(2);
+    const auto z = TestType(i);
+    p1.push_back(vec3{x, 0, z});
+    p2.push_back(vec3{x + 1, 0, z});
+    p3.push_back(vec3{x, 1, z});
+  }
+
+  const auto check = [&](const ray<TestType, 3>& r) {
+    auto expected = std::optional<std::tuple<TestType, size_t>>{};
+    for (size_t i = 0; i < p1.size(); ++i)
+    {
+      if (const auto dist = intersect_ray_triangle(r, p1[i], p2[i], p3[i]))
+      {
+        if (!expected || *dist < std::get<0>(*expected))
+        {
+          expected = std::tuple{*dist, i};
+        }
+      }
+    }
+
+    const auto actual = intersect_ray_triangles(r, p1, p2, p3);
+    REQUIRE(actual.has_value() == expected.has_value());
+    if (actual)
+    {
+      CHECK(std::get<0>(*actual) == approx(std::get<0>(*expected)));
+      CHECK(std::get<1>(*actual) == std::get<1>(*expected));
+    }
+  };
+
+  SECTION("Ray hits one triangle")
+  {
+    check(ray<TestType, 3>{vec3{6.25, 0.25, 20}, vec3{0, 0, -1}});
+    check(ray<TestType, 3>{vec3{20.25, 0.25, 20}, vec3{0, 0, -1}});
+  }
+
+  SECTION("Ray hits several triangles")
+  {
+    const auto r =
+      ray<TestType, 3>{vec3{-1, 0.25, 0}, normalize(vec3{TestType(2), 0, TestType(1)})};
+    check(r);
+  }
+
+  SECTION("Ray misses all triangles")
+  {
+    check(ray<TestType, 3>{vec3{1.5, 0.75, 20}, vec3{0, 0, -1}});
+    check(ray<TestType, 3>{vec3{0.25, 0.25, 20}, vec3{1, 0, 0}});
+  }
+
+  SECTION("No triangles")
+  {
+    CHECK(
+      intersect_ray_triangles(
+        ray<TestType, 3>{vec3{0, 0, 1}, vec3{0, 0, -1}},
+        point_batch<TestType>{},
+        point_batch<TestType>{},
+        point_batch<TestType>{})
+      == std::nullopt);
+  }
+}
+
+TEMPLATE_TEST_CASE("batch.bounds", "", float, double)
+{
+  const auto count = GENERATE(size_t(1), size_t(3), size_t(8), size_t(37));
+  const auto points = make_points<TestType>(count, TestType(0.25));
+
+  CHECK(
+    bounds(point_batch<TestType>{points})
+    == bbox<TestType, 3>::merge_all(points.begin(), points.end()));
+}
+} // namespace vm